@@ -1,11 +1,200 @@
 #pragma once
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
 #include <charconv>
+#include <cstdint>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if AOC_TRACE
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+// Hot-path tracing.
+// Configure with -DAOC_TRACE=ON to record scoped spans and named counters into
+// per-thread ring buffers, written as Chrome trace_event JSON (load it in
+// chrome://tracing or ui.perfetto.dev) to $AOC_TRACE_FILE, default
+// aoc_trace.json, at exit. Without the option the macros expand to nothing.
+// Usage: AOC_TRACE_SCOPE("parse_input"); AOC_TRACE_COUNTER("edges", edges.size());
+#if AOC_TRACE
+#define AOC_TRACE_CONCAT_IMPL(a, b) a##b
+#define AOC_TRACE_CONCAT(a, b) AOC_TRACE_CONCAT_IMPL(a, b)
+#define AOC_TRACE_SCOPE(name) const ::aoc::trace::Span AOC_TRACE_CONCAT(aoc_trace_span_, __LINE__)(name)
+#define AOC_TRACE_COUNTER(name, value) ::aoc::trace::counter(name, static_cast<double>(value))
+#else
+#define AOC_TRACE_SCOPE(name) static_cast<void>(0)
+#define AOC_TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
+
+#if AOC_TRACE
+namespace aoc::trace
+{
+
+struct Event
+{
+    const char* name;  // Must be a string literal (or otherwise outlive the process)
+    uint64_t start_ns;
+    uint64_t duration_ns;  // Spans only
+    double value;          // Counters only
+    char phase;            // 'X' complete span, 'C' counter
+};
+
+// Fixed-capacity ring; once full the oldest events are overwritten, so a long
+// run keeps its most recent history without unbounded memory.
+struct ThreadBuffer
+{
+    static constexpr size_t kCapacity = 1 << 16;
+
+    explicit ThreadBuffer(uint32_t tid) : tid(tid), events(kCapacity) {}
+
+    void push(const Event& event)
+    {
+        events[count % kCapacity] = event;
+        ++count;
+    }
+
+    uint32_t tid;
+    uint64_t count = 0;
+    std::vector<Event> events;
+};
+
+class Tracer
+{
+  public:
+    static Tracer& instance()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    uint64_t now_ns() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch_).count();
+    }
+
+    // Buffers are owned here rather than by the thread_local, so events from
+    // threads that already exited are still flushed.
+    ThreadBuffer& local_buffer()
+    {
+        thread_local ThreadBuffer* buffer = [this] {
+            std::lock_guard lock(mutex_);
+            buffers_.push_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(buffers_.size())));
+            return buffers_.back().get();
+        }();
+        return *buffer;
+    }
+
+    void flush(const char* path)
+    {
+        std::lock_guard lock(mutex_);
+        std::FILE* out = std::fopen(path, "w");
+        if (out == nullptr)
+        {
+            return;
+        }
+        std::fputs("{\"displayTimeUnit\": \"ns\", \"traceEvents\": [", out);
+        bool first = true;
+        for (const auto& buffer : buffers_)
+        {
+            uint64_t begin = buffer->count > ThreadBuffer::kCapacity ? buffer->count - ThreadBuffer::kCapacity : 0;
+            for (uint64_t i = begin; i < buffer->count; ++i)
+            {
+                const Event& e = buffer->events[i % ThreadBuffer::kCapacity];
+                std::fputs(first ? "\n" : ",\n", out);
+                first = false;
+                if (e.phase == 'X')
+                {
+                    std::fprintf(out, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}",
+                                 e.name, buffer->tid, e.start_ns / 1e3, e.duration_ns / 1e3);
+                }
+                else
+                {
+                    std::fprintf(out,
+                                 "{\"name\": \"%s\", \"ph\": \"C\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, "
+                                 "\"args\": {\"value\": %.17g}}",
+                                 e.name, buffer->tid, e.start_ns / 1e3, e.value);
+                }
+            }
+        }
+        std::fputs("\n]}\n", out);
+        std::fclose(out);
+    }
+
+    ~Tracer()
+    {
+        const char* path = std::getenv("AOC_TRACE_FILE");
+        flush(path != nullptr ? path : "aoc_trace.json");
+    }
+
+  private:
+    Tracer() : epoch_(std::chrono::steady_clock::now()) {}
+
+    std::chrono::steady_clock::time_point epoch_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+};
+
+class Span
+{
+  public:
+    explicit Span(const char* name) : name_(name), start_ns_(Tracer::instance().now_ns()) {}
+    ~Span()
+    {
+        auto& tracer = Tracer::instance();
+        tracer.local_buffer().push({name_, start_ns_, tracer.now_ns() - start_ns_, 0.0, 'X'});
+    }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+  private:
+    const char* name_;
+    uint64_t start_ns_;
+};
+
+inline void counter(const char* name, double value)
+{
+    auto& tracer = Tracer::instance();
+    tracer.local_buffer().push({name, tracer.now_ns(), 0, value, 'C'});
+}
+
+}  // namespace aoc::trace
+#endif
 
 namespace aoc
 {
@@ -15,6 +204,7 @@ namespace aoc
 // All views (string_view) must not outlive this string.
 inline std::string read_file(const std::filesystem::path& path)
 {
+    AOC_TRACE_SCOPE("read_file");
     std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
     if (!file)
     {
@@ -32,6 +222,283 @@ inline std::string read_file(const std::filesystem::path& path)
     return content;
 }
 
+// Read-only view over a whole input file.
+// Regular files are memory-mapped, so the contents are never copied and the
+// page cache is shared with the kernel. Pipes, character devices and other
+// non-regular files cannot be mapped and are read into an owned buffer instead.
+// Converts implicitly to std::string_view, so it can be passed anywhere
+// read_file's result is accepted. All views must not outlive this object.
+class MappedFile
+{
+  public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+        AOC_TRACE_SCOPE("map_file");
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Could not open file: " + path.string());
+        }
+
+        struct stat st{};
+        if (::fstat(fd, &st) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("Could not stat file: " + path.string());
+        }
+
+        if (S_ISREG(st.st_mode) && st.st_size > 0)
+        {
+            size_ = static_cast<size_t>(st.st_size);
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Could not map file: " + path.string() + " (" + std::strerror(errno) + ")");
+            }
+            // Parsers walk the input front to back exactly once; ask for
+            // aggressive read-ahead and start faulting pages in right away.
+            // Both are hints, so failures are ignored.
+            ::madvise(addr, size_, MADV_SEQUENTIAL);
+            ::madvise(addr, size_, MADV_WILLNEED);
+            data_ = static_cast<const char*>(addr);
+            mapped_ = true;
+        }
+        else if (!S_ISREG(st.st_mode))
+        {
+            read_stream(fd, path);
+            data_ = buffer_.data();
+            size_ = buffer_.size();
+        }
+
+        ::close(fd);
+    }
+
+    ~MappedFile() { release(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { steal(std::move(other)); }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            steal(std::move(other));
+        }
+        return *this;
+    }
+
+    std::string_view view() const noexcept { return {data_, size_}; }
+    operator std::string_view() const noexcept { return view(); }
+
+    const char* data() const noexcept { return data_; }
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    bool is_mapped() const noexcept { return mapped_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;  // Owner of the data when the input could not be mapped
+
+    // Size is unknown up front for pipes, so grow the buffer as data arrives.
+    void read_stream(int fd, const std::filesystem::path& path)
+    {
+        constexpr size_t kChunkSize = 1 << 16;
+        size_t used = 0;
+        while (true)
+        {
+            buffer_.resize(used + kChunkSize);
+            ssize_t n = ::read(fd, buffer_.data() + used, kChunkSize);
+            if (n < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                ::close(fd);
+                throw std::runtime_error("Could not read file: " + path.string());
+            }
+            if (n == 0)
+            {
+                break;
+            }
+            used += static_cast<size_t>(n);
+        }
+        buffer_.resize(used);
+    }
+
+    void release() noexcept
+    {
+        if (mapped_)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+        buffer_.clear();
+    }
+
+    void steal(MappedFile&& other) noexcept
+    {
+        mapped_ = std::exchange(other.mapped_, false);
+        size_ = std::exchange(other.size_, 0);
+        buffer_ = std::move(other.buffer_);
+        const char* other_data = std::exchange(other.data_, nullptr);
+        // A moved std::string may relocate short (SSO) contents, so re-point
+        // at our own buffer unless the data lives in a mapping.
+        data_ = mapped_ ? other_data : buffer_.data();
+    }
+};
+
+// Streams lines out of a file using a fixed-size buffer, for inputs that are
+// too large to load or map as a whole.
+// Lines are returned as string_views into the internal buffer and are only
+// valid until the next call to next(). A line split across two reads is
+// completed by moving its head to the front of the buffer before refilling, so
+// memory stays O(buffer_size) regardless of the file size. A single line longer
+// than the buffer grows it to fit that line.
+// Usage: for (auto line : LineReader{path}) { ... to_int(line.substr(1)) ... }
+class LineReader
+{
+  public:
+    static constexpr size_t kDefaultBufferSize = 1 << 20;
+
+    explicit LineReader(const std::filesystem::path& path, size_t buffer_size = kDefaultBufferSize)
+        : buffer_(std::max<size_t>(buffer_size, 1)), owns_fd_(true)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0)
+        {
+            throw std::runtime_error("Could not open file: " + path.string());
+        }
+        ::posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    // Reads from an already open descriptor (e.g. STDIN_FILENO); does not close it.
+    explicit LineReader(int fd, size_t buffer_size = kDefaultBufferSize)
+        : buffer_(std::max<size_t>(buffer_size, 1)), fd_(fd), owns_fd_(false)
+    {
+    }
+
+    ~LineReader()
+    {
+        if (owns_fd_ && fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+    }
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    // Returns the next line without its newline, or nullopt at end of input.
+    std::optional<std::string_view> next()
+    {
+        while (true)
+        {
+            if (auto* nl = static_cast<char*>(std::memchr(buffer_.data() + scan_, '\n', tail_ - scan_)))
+            {
+                std::string_view line(buffer_.data() + head_, nl - (buffer_.data() + head_));
+                head_ = scan_ = static_cast<size_t>(nl - buffer_.data()) + 1;
+                return line;
+            }
+            scan_ = tail_;
+
+            if (eof_)
+            {
+                if (head_ == tail_)
+                {
+                    return std::nullopt;
+                }
+                std::string_view line(buffer_.data() + head_, tail_ - head_);
+                head_ = scan_ = tail_;
+                return line;
+            }
+            refill();
+        }
+    }
+
+    class Iterator
+    {
+      public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(LineReader* reader) : reader_(reader) { ++*this; }
+
+        std::string_view operator*() const { return line_; }
+        Iterator& operator++()
+        {
+            if (auto line = reader_->next())
+            {
+                line_ = *line;
+            }
+            else
+            {
+                reader_ = nullptr;
+            }
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(std::default_sentinel_t) const { return reader_ == nullptr; }
+
+      private:
+        LineReader* reader_ = nullptr;
+        std::string_view line_;
+    };
+
+    Iterator begin() { return Iterator{this}; }
+    std::default_sentinel_t end() { return {}; }
+
+  private:
+    std::vector<char> buffer_;
+    size_t head_ = 0;  // Start of the first unconsumed line
+    size_t scan_ = 0;  // Everything in [head_, scan_) is known to contain no newline
+    size_t tail_ = 0;  // End of valid data
+    int fd_ = -1;
+    bool owns_fd_ = false;
+    bool eof_ = false;
+
+    void refill()
+    {
+        // Slide the partial line to the front; only ever moves less than one line.
+        if (head_ > 0)
+        {
+            std::memmove(buffer_.data(), buffer_.data() + head_, tail_ - head_);
+            tail_ -= head_;
+            scan_ -= head_;
+            head_ = 0;
+        }
+        if (tail_ == buffer_.size())
+        {
+            buffer_.resize(buffer_.size() * 2);
+        }
+
+        while (true)
+        {
+            ssize_t n = ::read(fd_, buffer_.data() + tail_, buffer_.size() - tail_);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (n < 0)
+            {
+                throw std::runtime_error(std::string("Could not read input: ") + std::strerror(errno));
+            }
+            eof_ = n == 0;
+            tail_ += static_cast<size_t>(n);
+            return;
+        }
+    }
+};
+
 // Splits a string_view by a delimiter.
 // Returns a view of subranges.
 // Usage: for (auto part : split(sv, ',')) { ... }
@@ -64,6 +531,247 @@ constexpr auto get_lines(std::string_view s)
     return split(s, '\n');
 }
 
+// Cuts s into at most num_pieces consecutive pieces of similar size, each
+// ending just after a newline (or at the end of s), so no line is split
+// between two pieces. Used to hand whole lines to parallel workers.
+inline std::vector<std::string_view> split_line_aligned(std::string_view s, size_t num_pieces)
+{
+    std::vector<std::string_view> pieces;
+    num_pieces = std::max<size_t>(num_pieces, 1);
+    size_t begin = 0;
+    for (size_t i = 1; i <= num_pieces && begin < s.size(); ++i)
+    {
+        const size_t cut = i == num_pieces ? s.size() : std::max(begin, s.size() / num_pieces * i);
+        const size_t newline = cut < s.size() ? s.find('\n', cut) : std::string_view::npos;
+        const size_t end = newline == std::string_view::npos ? s.size() : newline + 1;
+        pieces.push_back(s.substr(begin, end - begin));
+        begin = end;
+    }
+    return pieces;
+}
+
+// Calls f(pos) for every position of character c in s, in increasing order.
+// Compares 32 (AVX2) or 16 (SSE2) bytes at a time and walks the resulting
+// movemask bits, so long runs without a match cost one compare per block.
+template <typename F>
+void for_each_char(std::string_view s, char c, F&& f)
+{
+    const char* p = s.data();
+    const size_t n = s.size();
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    const __m256i needle32 = _mm256_set1_epi8(c);
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle32)));
+        while (mask != 0)
+        {
+            f(i + static_cast<size_t>(__builtin_ctz(mask)));
+            mask &= mask - 1;
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i needle16 = _mm_set1_epi8(c);
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle16)));
+        while (mask != 0)
+        {
+            f(i + static_cast<size_t>(__builtin_ctz(mask)));
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < n; ++i)
+    {
+        if (p[i] == c)
+        {
+            f(i);
+        }
+    }
+}
+
+// Random-access index over the lines of a buffer.
+// Built with a single SIMD pass over the newlines. A trailing newline does not
+// produce an extra empty line, and a final line without one is still counted.
+// When every line has the same width (grid-shaped inputs) the offsets array is
+// dropped and line(i) is plain stride arithmetic.
+// Like string_view, the index must not outlive the buffer it was built from.
+class LineIndex
+{
+  public:
+    LineIndex() = default;
+
+    explicit LineIndex(std::string_view content) : content_(content)
+    {
+        // offsets_[i] is the start of line i; offsets_[size()] is one past the
+        // newline ending the last line (virtual if the input lacks one).
+        offsets_.reserve(content.size() / 64 + 2);
+        offsets_.push_back(0);
+        for_each_char(content, '\n', [&](size_t pos) { offsets_.push_back(pos + 1); });
+        if (offsets_.back() != content.size())
+        {
+            offsets_.push_back(content.size() + 1);
+        }
+        num_lines_ = offsets_.size() - 1;
+
+        fixed_width_ = true;
+        width_ = num_lines_ > 0 ? offsets_[1] - 1 : 0;
+        for (size_t i = 1; i < num_lines_ && fixed_width_; ++i)
+        {
+            fixed_width_ = offsets_[i + 1] - offsets_[i] - 1 == width_;
+        }
+
+        if (fixed_width_)
+        {
+            offsets_.clear();
+            offsets_.shrink_to_fit();
+        }
+    }
+
+    constexpr std::string_view content() const noexcept { return content_; }
+    constexpr size_t size() const noexcept { return num_lines_; }
+    constexpr bool empty() const noexcept { return num_lines_ == 0; }
+
+    // True if all lines have the same length; width() is then that length.
+    constexpr bool fixed_width() const noexcept { return fixed_width_; }
+    constexpr size_t width() const noexcept { return fixed_width_ ? width_ : 0; }
+
+    // Offset of the first character of line i within the content.
+    constexpr size_t line_start(size_t i) const noexcept { return fixed_width_ ? i * (width_ + 1) : offsets_[i]; }
+
+    constexpr std::string_view line(size_t i) const noexcept
+    {
+        size_t start = line_start(i);
+        size_t len = fixed_width_ ? width_ : offsets_[i + 1] - start - 1;
+        return content_.substr(start, len);
+    }
+
+    constexpr std::string_view operator[](size_t i) const noexcept { return line(i); }
+
+    // Contiguous slice of the content holding lines [first, last), including
+    // their newlines. Useful for handing a block of lines to a worker thread.
+    constexpr std::string_view block(size_t first, size_t last) const noexcept
+    {
+        if (first >= last)
+        {
+            return {};
+        }
+        size_t start = line_start(first);
+        size_t end = std::min(line_start(last), content_.size());
+        return content_.substr(start, end - start);
+    }
+
+    // Usage: for (auto line : index.lines()) { ... }
+    auto lines() const
+    {
+        return std::views::iota(size_t{0}, num_lines_) | std::views::transform([this](size_t i) { return line(i); });
+    }
+
+  private:
+    std::string_view content_;
+    std::vector<size_t> offsets_;
+    size_t num_lines_ = 0;
+    size_t width_ = 0;
+    bool fixed_width_ = false;
+};
+
+// Neighbor steps as (row, col) deltas, for Grid::neighbor_offsets.
+inline constexpr std::array<std::pair<int, int>, 4> kOrthogonalNeighbors = {{{-1, 0}, {0, -1}, {0, 1}, {1, 0}}};
+inline constexpr std::array<std::pair<int, int>, 8> kAllNeighbors = {
+    {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+
+/**
+ * @brief Dense 2D grid surrounded by a sentinel border.
+ *
+ * Cells are stored row-major in one contiguous vector, with Border rows and
+ * columns of a sentinel value on every side. Coordinates run from -Border to
+ * rows + Border - 1 (and likewise for columns), so a neighbor loop over the
+ * cells inside the grid reads the sentinel at the edges instead of needing
+ * bounds checks. neighbor_offsets turns a set of neighbor steps into flat
+ * index offsets, so such a loop becomes plain pointer arithmetic.
+ */
+template <typename T, int Border = 1>
+struct Grid
+{
+    static_assert(Border >= 0, "Border width must be non-negative");
+
+    int rows = 0;
+    int cols = 0;
+    int stride = 0;  // cols + 2 * Border
+    std::vector<T> cells;
+
+    Grid() = default;
+
+    Grid(int num_rows, int num_cols, T fill = T{}, T sentinel = T{})
+        : rows(num_rows), cols(num_cols), stride(num_cols + 2 * Border),
+          cells(static_cast<size_t>(num_rows + 2 * Border) * static_cast<size_t>(stride), sentinel)
+    {
+        for (int r = 0; r < rows; ++r)
+        {
+            std::fill_n(cells.begin() + index(r, 0), cols, fill);
+        }
+    }
+
+    /**
+     * @brief Builds a grid from line-separated text, one cell per character.
+     *
+     * Trailing empty lines are ignored and the width is that of the first line;
+     * cells missing from shorter lines are left as the sentinel. to_cell maps
+     * each character to a cell value.
+     */
+    template <typename F = std::identity>
+        requires std::invocable<F&, char>
+    static Grid from_text(std::string_view content, T sentinel, F to_cell = {})
+    {
+        const LineIndex lines(content);
+        int num_rows = static_cast<int>(lines.size());
+        while (num_rows > 0 && lines[num_rows - 1].empty())
+        {
+            --num_rows;
+        }
+        const int num_cols = num_rows > 0 ? static_cast<int>(lines[0].size()) : 0;
+
+        Grid grid(num_rows, num_cols, sentinel, sentinel);
+        for (int r = 0; r < num_rows; ++r)
+        {
+            const auto line = lines[r];
+            const int n = std::min(num_cols, static_cast<int>(line.size()));
+            for (int c = 0; c < n; ++c)
+            {
+                grid(r, c) = static_cast<T>(to_cell(line[c]));
+            }
+        }
+        return grid;
+    }
+
+    // Flat position of (row, col); valid for -Border <= row < rows + Border.
+    constexpr size_t index(int row, int col) const noexcept
+    {
+        return static_cast<size_t>(row + Border) * static_cast<size_t>(stride) + static_cast<size_t>(col + Border);
+    }
+
+    constexpr T& operator()(int row, int col) { return cells[index(row, col)]; }
+    constexpr const T& operator()(int row, int col) const { return cells[index(row, col)]; }
+
+    // Flat offset of each (row, col) step: cells[index(r, c) + offsets[i]] is
+    // the i-th neighbor of (r, c). Steps must not exceed the border width.
+    template <size_t N>
+    constexpr std::array<std::ptrdiff_t, N> neighbor_offsets(const std::array<std::pair<int, int>, N>& steps) const
+    {
+        std::array<std::ptrdiff_t, N> offsets{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            offsets[i] = static_cast<std::ptrdiff_t>(steps[i].first) * stride + steps[i].second;
+        }
+        return offsets;
+    }
+};
+
 // Helper to convert a range (like a part from split) to a std::string.
 template <typename Range>
 std::string to_string(Range&& r)
@@ -90,4 +798,415 @@ T to_int(std::string_view sv)
     return result;
 }
 
+// Outcome of one parse_int_batch call. Errors are reported once per batch
+// rather than thrown from the hot loop.
+struct BatchParseResult
+{
+    size_t records = 0;            // Complete records written to the columns
+    size_t consumed = 0;           // Bytes of input consumed; resume from here
+    std::errc error = std::errc(); // invalid_argument or result_out_of_range
+    size_t error_offset = 0;       // Offset of the offending byte if error is set
+
+    explicit operator bool() const noexcept { return error == std::errc(); }
+};
+
+namespace detail
+{
+
+constexpr uint64_t kSwarOnes = 0x0101010101010101ULL;
+
+// Loads up to 8 bytes little-endian; bytes past end read as 0 (a non-digit).
+inline uint64_t load_u64(const char* p, const char* end) noexcept
+{
+    uint64_t word = 0;
+    std::memcpy(&word, p, std::min<size_t>(8, static_cast<size_t>(end - p)));
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        word = __builtin_bswap64(word);
+    }
+    return word;
+}
+
+// High bit set in every byte of word that is not an ASCII digit.
+constexpr uint64_t nondigit_mask(uint64_t word) noexcept
+{
+    uint64_t x = word ^ (kSwarOnes * '0');
+    return (((x & (kSwarOnes * 0x7F)) + kSwarOnes * (0x80 - 10)) | x) & (kSwarOnes * 0x80);
+}
+
+// Converts the first len (1..8) digit bytes of word, first byte most significant.
+// Shifting the digits to the top leaves zero bytes, which act as leading zeros.
+constexpr uint64_t parse_eight_digits(uint64_t word, unsigned len) noexcept
+{
+    word <<= 8 * (8 - len);
+    word &= kSwarOnes * 0x0F;
+    word = (word * (10 * 256 + 1)) >> 8;
+    word = ((word & 0x00FF00FF00FF00FFULL) * (100 * 65536 + 1)) >> 16;
+    word = ((word & 0x0000FFFF0000FFFFULL) * (10000ULL * (1ULL << 32) + 1)) >> 32;
+    return word & 0xFFFFFFFFULL;
+}
+
+constexpr std::array<uint64_t, 9> kPow10U64 = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+constexpr std::array<bool, 256> make_char_table(std::string_view chars) noexcept
+{
+    std::array<bool, 256> table{};
+    for (char c : chars)
+    {
+        table[static_cast<unsigned char>(c)] = true;
+    }
+    return table;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Parses delimiter-separated unsigned integers straight into SoA columns.
+ *
+ * Characters from delims separate numbers; the i-th number goes to
+ * columns[i % NumFields][i / NumFields]. For example, day08's "x,y,z" lines
+ * are parsed with delims ",\n" and three columns, and day02's "a-b,c-d" with
+ * delims "-,\n" and two columns. Records may be separated by any run of
+ * delimiters, so blank lines and CRLF endings are fine, but the fields of one
+ * record take exactly one delimiter between them, and it may not be '\n'. A
+ * doubled delimiter ("1--2") or a line break inside a record is an
+ * invalid_argument error, so a line with a missing field cannot shift the
+ * fields of every later line.
+ *
+ * Digit runs are located and converted eight bytes at a time with SWAR
+ * arithmetic, so there is no per-line split and no per-number from_chars.
+ * Parsing stops when the columns are full, at the end of the buffer, or at the
+ * first byte that is neither a digit nor a delimiter. `consumed` always lies on
+ * a record boundary, so a caller can refill the columns and continue.
+ */
+template <std::integral T, size_t NumFields>
+    requires(NumFields > 0)
+BatchParseResult parse_int_batch(std::string_view buffer, std::string_view delims,
+                                 const std::array<std::span<T>, NumFields>& columns)
+{
+    const auto is_delim = detail::make_char_table(delims);
+    size_t capacity = columns[0].size();
+    for (const auto& column : columns)
+    {
+        capacity = std::min(capacity, column.size());
+    }
+
+    const char* const begin = buffer.data();
+    const char* const end = begin + buffer.size();
+    const char* p = begin;
+    const char* record_end = begin;
+    size_t field = 0;
+    BatchParseResult result;
+
+    while (true)
+    {
+        const char* const separator = p;
+        while (p < end && is_delim[static_cast<unsigned char>(*p)])
+        {
+            ++p;
+        }
+        if (field == 0)
+        {
+            record_end = p;
+            if (p == end || result.records == capacity)
+            {
+                break;
+            }
+        }
+        else if (p == end)
+        {
+            result.error = std::errc::invalid_argument;  // Trailing partial record
+            result.error_offset = buffer.size();
+            break;
+        }
+        else if (p - separator != 1 || *separator == '\n')
+        {
+            // Missing, doubled or line-breaking separator inside a record
+            const char* const bad = p == separator || *separator == '\n' ? separator : separator + 1;
+            result.error = std::errc::invalid_argument;
+            result.error_offset = static_cast<size_t>(bad - begin);
+            break;
+        }
+
+        uint64_t value = 0;
+        unsigned num_digits = 0;
+        while (true)
+        {
+            uint64_t word = detail::load_u64(p, end);
+            uint64_t mask = detail::nondigit_mask(word);
+            unsigned len = mask == 0 ? 8 : static_cast<unsigned>(std::countr_zero(mask)) / 8;
+            if (len == 0)
+            {
+                break;
+            }
+            num_digits += len;
+            if (num_digits > std::numeric_limits<uint64_t>::digits10)
+            {
+                break;
+            }
+            value = value * detail::kPow10U64[len] + detail::parse_eight_digits(word, len);
+            p += len;
+            if (len < 8)
+            {
+                break;
+            }
+        }
+
+        if (num_digits == 0)
+        {
+            result.error = std::errc::invalid_argument;
+            result.error_offset = static_cast<size_t>(p - begin);
+            break;
+        }
+        if (num_digits > std::numeric_limits<uint64_t>::digits10 ||
+            value > static_cast<uint64_t>(std::numeric_limits<T>::max()))
+        {
+            result.error = std::errc::result_out_of_range;
+            result.error_offset = static_cast<size_t>(p - begin);
+            break;
+        }
+
+        columns[field][result.records] = static_cast<T>(value);
+        if (++field == NumFields)
+        {
+            field = 0;
+            ++result.records;
+        }
+    }
+
+    result.consumed = static_cast<size_t>(record_end - begin);
+    return result;
+}
+
+// Parses a whole buffer with parse_int_batch, growing the columns batch by
+// batch. Throws once, with the failing offset, if any batch reports an error.
+// Usage: auto [xs, ys] = parse_int_columns<long, 2>(content, ",\n");
+template <std::integral T, size_t NumFields>
+    requires(NumFields > 0)
+std::array<std::vector<T>, NumFields> parse_int_columns(std::string_view buffer, std::string_view delims)
+{
+    std::array<std::vector<T>, NumFields> columns;
+    size_t num_records = 0;
+    size_t offset = 0;
+    size_t batch_size = buffer.size() / (8 * NumFields) + 16;
+
+    while (offset < buffer.size())
+    {
+        std::array<std::span<T>, NumFields> spans;
+        for (size_t i = 0; i < NumFields; ++i)
+        {
+            columns[i].resize(num_records + batch_size);
+            spans[i] = std::span<T>(columns[i]).subspan(num_records);
+        }
+
+        auto result = parse_int_batch<T, NumFields>(buffer.substr(offset), delims, spans);
+        num_records += result.records;
+        offset += result.consumed;
+        if (!result)
+        {
+            throw std::runtime_error("Failed to parse integer list at offset " +
+                                     std::to_string(offset + (result.error_offset - result.consumed)));
+        }
+        if (result.records < batch_size)
+        {
+            break;
+        }
+        batch_size *= 2;
+    }
+
+    for (auto& column : columns)
+    {
+        column.resize(num_records);
+    }
+    return columns;
+}
+
+// Monotonic (bump-pointer) arena for parse-time allocations.
+// Wraps std::pmr::monotonic_buffer_resource: allocating is a pointer bump,
+// deallocating is a no-op, and everything is freed at once by release() or
+// the destructor. Parse functions take a std::pmr::memory_resource* and build
+// std::pmr containers, so a full parse costs a handful of upstream mallocs.
+// The resource lives on the heap, so moving an Arena keeps every pointer into
+// it (and every pmr container using it) valid.
+class Arena
+{
+  public:
+    static constexpr size_t kDefaultBlockSize = 1 << 16;
+
+    explicit Arena(size_t initial_block_size = kDefaultBlockSize)
+        : resource_(std::make_unique<std::pmr::monotonic_buffer_resource>(initial_block_size))
+    {
+    }
+
+    // Serves allocations from a caller-owned (e.g. stack) buffer first and only
+    // falls back to the heap once it is exhausted. release() rewinds to it.
+    explicit Arena(std::span<std::byte> initial_buffer)
+        : resource_(std::make_unique<std::pmr::monotonic_buffer_resource>(initial_buffer.data(), initial_buffer.size()))
+    {
+    }
+
+    std::pmr::memory_resource* resource() const noexcept { return resource_.get(); }
+
+    template <typename T = std::byte>
+    std::pmr::polymorphic_allocator<T> allocator() const noexcept
+    {
+        return resource();
+    }
+
+    void release() { resource_->release(); }
+
+  private:
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> resource_;
+};
+
+// A value built from its own Arena, bundled so the two move and die together.
+// Usage: ArenaBacked<Graph> g([&](auto* resource) { return parse_graph(content, resource); });
+template <typename T>
+struct ArenaBacked
+{
+    template <typename F>
+        requires std::invocable<F&, std::pmr::memory_resource*>
+    explicit ArenaBacked(F&& make, size_t initial_block_size = Arena::kDefaultBlockSize)
+        : arena(initial_block_size), value(make(arena.resource()))
+    {
+    }
+
+    Arena arena;  // Declared first: must outlive value
+    T value;
+};
+
+// Fixed-size pool of worker threads draining a shared FIFO of tasks.
+// Tasks may submit further tasks; wait_idle() returns once every task
+// submitted so far, including those, has finished.
+class ThreadPool
+{
+  public:
+    static size_t default_concurrency() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+    explicit ThreadPool(size_t num_threads = default_concurrency())
+    {
+        workers_.reserve(num_threads);
+        for (size_t i = 0; i < std::max<size_t>(num_threads, 1); ++i)
+        {
+            workers_.emplace_back([this] { worker_loop(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        work_cv_.notify_all();
+        for (auto& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const noexcept { return workers_.size(); }
+
+    // Queues fn and returns a future for its result (or exception).
+    template <typename F>
+    auto submit(F&& fn) -> std::future<std::invoke_result_t<std::decay_t<F>&>>
+    {
+        using R = std::invoke_result_t<std::decay_t<F>&>;
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+        auto future = task->get_future();
+        {
+            std::lock_guard lock(mutex_);
+            tasks_.emplace_back([task] { (*task)(); });
+            ++pending_;
+        }
+        work_cv_.notify_one();
+        return future;
+    }
+
+    // Must not be called from a worker thread.
+    void wait_idle()
+    {
+        std::unique_lock lock(mutex_);
+        idle_cv_.wait(lock, [this] { return pending_ == 0; });
+    }
+
+  private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable idle_cv_;
+    size_t pending_ = 0;  // Queued plus running
+    bool stopping_ = false;
+
+    void worker_loop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex_);
+                work_cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty())
+                {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+
+            task();
+
+            std::lock_guard lock(mutex_);
+            if (--pending_ == 0)
+            {
+                idle_cv_.notify_all();
+            }
+        }
+    }
+};
+
+/**
+ * @brief Runs fn(i) for every i in [0, num_tasks) on the pool and waits.
+ *
+ * Each index is one task, so callers choose the granularity (typically a few
+ * blocks per worker). The first exception thrown by a task is rethrown here
+ * after all tasks have finished. Must not be called from a worker of the same
+ * pool, since the caller blocks while the tasks wait for a free worker.
+ */
+template <typename F>
+    requires std::invocable<F&, size_t>
+void parallel_for(ThreadPool& pool, size_t num_tasks, F&& fn)
+{
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        futures.push_back(pool.submit([&fn, i] { fn(i); }));
+    }
+
+    std::exception_ptr error;
+    for (auto& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
 }  // namespace aoc
@@ -0,0 +1,587 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day01
+{
+
+// Helper for floor division (rounds towards negative infinity)
+// Used to handle negative coordinates correctly.
+/*
+ * edge cases for left turns crossing zero:
+ * start = 101, val = 102   => floor_div(100, 100) - floor_div(-2, 100)   = 1  - (-1) = 2
+ * start = 1, val = 2       => floor_div(0, 100)   - floor_div(-2, 100)   = 0  - (-1) = 1
+ * start = 1, val = 1       => floor_div(0, 100)   - floor_div(-1,100)    = 0  - (-1) = 1
+ * start = 30, val = 32     => floor_div(29, 100)  - floor_div(-3, 100)   = 0  - (-1) = 1
+ * start = 30, val = 28     => floor_div(30, 100)  - floor_div(1, 100)    = 0  - 0    = 0
+ * start = 30, val = 330    => floor_div(29, 100)  - floor_div(-301, 100) = 0  - (-4) = 0
+ * start = 0, val = 10      => floor_div(-1, 100)  - floor_div(-11, 100)  = -1 - (-1) = 0
+ */
+
+constexpr int floor_div(int a, int b)
+{
+    int res = a / b;
+    // In C++, % can return negative values if a is negative.
+    // If there is a remainder and the result is negative (due to a < 0),
+    // we need to subtract 1 to floor it.
+    // Since b is always 100 here, we just check if remainder is negative.
+    if (a % b < 0)
+    {
+        --res;
+    }
+    return res;
+}
+
+struct Instruction
+{
+    char turn;
+    int distance;
+};
+
+// Parses a single non-empty line of the form "L68" or "R48".
+inline Instruction parse_instruction(std::string_view line)
+{
+    return {line[0], to_int<int>(line.substr(1))};
+}
+
+inline std::pmr::vector<Instruction> parse_instructions(
+    std::string_view content, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    AOC_TRACE_SCOPE("day01::parse_instructions");
+    std::pmr::vector<Instruction> instructions(resource);
+
+    // Size exactly once up front: in an arena, blocks left behind by growth are
+    // not reclaimed until the whole arena is released.
+    size_t num_lines = 1;
+    for_each_char(content, '\n', [&](size_t) { ++num_lines; });
+    instructions.reserve(num_lines);
+
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        instructions.push_back(parse_instruction(line));
+    }
+
+    return instructions;
+}
+
+/**
+ * @brief Streaming counterpart of parse_instructions.
+ *
+ * Calls on_instruction for every instruction read from the stream without
+ * materializing them, so memory is bounded by the reader's buffer no matter
+ * how long the instruction log is.
+ */
+template <typename F>
+    requires std::invocable<F&, const Instruction&>
+void stream_instructions(LineReader& reader, F&& on_instruction)
+{
+    for (auto line : reader)
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        on_instruction(parse_instruction(line));
+    }
+}
+
+inline int part1(std::span<const Instruction> instructions)
+{
+    AOC_TRACE_SCOPE("day01::part1");
+    int start = 50;
+    int count = 0;
+
+    for (const auto& [rot, val] : instructions)
+    {
+        start = rot == 'L' ? start - val : start + val;
+        start = rot == 'L' ? (start % 100 + 100) % 100 : start % 100;
+        count = start == 0 ? count + 1 : count;
+    }
+    return count;
+}
+
+inline int part2(std::span<const Instruction> instructions)
+{
+    AOC_TRACE_SCOPE("day01::part2");
+    int start = 50;
+    int count = 0;
+    for (const auto& [rot, val] : instructions)
+    {
+        {
+            if (rot == 'L')
+            {
+                // floor_div is used to make C++ negative division rounds down, rather than
+                // truncating toward zero
+                count += floor_div(start - 1, 100) - floor_div(start - val - 1, 100);
+                start -= val;
+                start = (start % 100 + 100) % 100;  // negative modulo
+            }
+            else if (rot == 'R')
+            {
+                start += val;
+                count += start / 100;
+                start = start % 100;
+            }
+        }
+    }
+    return count;
+}
+
+constexpr int kDialSize = 100;
+constexpr int kDialStart = 50;
+
+// Both answers for one dial.
+struct DialCounts
+{
+    long long part1 = 0;
+    long long part2 = 0;
+};
+
+/**
+ * @brief Effect of a block of instructions on the dial, for every entry position.
+ *
+ * Running the block from entry position p leaves the dial at
+ * (p + shift) % kDialSize, lands on zero zeros[p] times (part 1) and passes or
+ * lands on zero passes[p] times (part 2). Summaries of adjacent blocks compose
+ * with combine(), which is associative, so a long instruction log can be
+ * summarized block by block in parallel and folded afterwards.
+ */
+struct DialSummary
+{
+    int shift = 0;
+    std::array<long long, kDialSize> zeros{};
+    std::array<long long, kDialSize> passes{};
+};
+
+/**
+ * @brief Summarizes a block in one pass, independent of the entry position.
+ *
+ * Let q be the block's running offset before a step. Entering at p, the step
+ * starts from s = (p + q) % kDialSize, so it ends on zero iff p == -q' (q' the
+ * offset after the step), giving a histogram over p. It passes zero
+ * distance / kDialSize times plus once more iff s lies in a contiguous range
+ * that depends only on distance % kDialSize: [kDialSize - r, kDialSize) when
+ * turning right, [1, r] when turning left. Shifted by -q that range is a
+ * cyclic range of p, accumulated in a difference array.
+ */
+inline DialSummary summarize_block(std::span<const Instruction> instructions)
+{
+    DialSummary summary;
+    std::array<long long, kDialSize + 1> pass_diff{};
+    long long full_turns = 0;
+
+    const auto add_cyclic = [&](int first, int length) {
+        pass_diff[first] += 1;
+        if (first + length <= kDialSize)
+        {
+            pass_diff[first + length] -= 1;
+        }
+        else
+        {
+            pass_diff[kDialSize] -= 1;
+            pass_diff[0] += 1;
+            pass_diff[first + length - kDialSize] -= 1;
+        }
+    };
+
+    int offset = 0;
+    for (const auto& [rot, val] : instructions)
+    {
+        const int r = val % kDialSize;
+        full_turns += val / kDialSize;
+        if (r != 0)
+        {
+            const int range_start = rot == 'L' ? 1 : kDialSize - r;
+            add_cyclic((range_start - offset + kDialSize) % kDialSize, r);
+        }
+
+        offset = (offset + (rot == 'L' ? kDialSize - r : r)) % kDialSize;
+        ++summary.zeros[(kDialSize - offset) % kDialSize];
+    }
+
+    long long running = 0;
+    for (int p = 0; p < kDialSize; ++p)
+    {
+        running += pass_diff[p];
+        summary.passes[p] = full_turns + running;
+    }
+    summary.shift = offset;
+    return summary;
+}
+
+// Summary of running `first` and then `second`.
+inline DialSummary combine(const DialSummary& first, const DialSummary& second)
+{
+    DialSummary result;
+    result.shift = (first.shift + second.shift) % kDialSize;
+    for (int p = 0; p < kDialSize; ++p)
+    {
+        const int mid = (p + first.shift) % kDialSize;
+        result.zeros[p] = first.zeros[p] + second.zeros[mid];
+        result.passes[p] = first.passes[p] + second.passes[mid];
+    }
+    return result;
+}
+
+/**
+ * @brief Parallel scan over the instruction log.
+ *
+ * Splits the log into a few blocks per worker, summarizes each block on the
+ * pool, then folds the summaries left to right. The fold is O(blocks * 100),
+ * so the work is O(n / threads) and the answers match the serial part1/part2.
+ */
+inline DialSummary summarize_parallel(std::span<const Instruction> instructions, ThreadPool& pool,
+                                      size_t min_block_size = 1 << 16)
+{
+    AOC_TRACE_SCOPE("day01::summarize_parallel");
+    const size_t max_blocks = std::max<size_t>(1, instructions.size() / min_block_size);
+    const size_t num_blocks = std::min(pool.size() * 4, max_blocks);
+    const size_t block_size = (instructions.size() + num_blocks - 1) / num_blocks;
+
+    std::vector<DialSummary> blocks(num_blocks);
+    parallel_for(pool, num_blocks, [&](size_t i) {
+        const size_t first = std::min(i * block_size, instructions.size());
+        const size_t count = std::min(block_size, instructions.size() - first);
+        blocks[i] = summarize_block(instructions.subspan(first, count));
+    });
+
+    DialSummary total;
+    for (const auto& block : blocks)
+    {
+        total = combine(total, block);
+    }
+    return total;
+}
+
+// Both answers from one parallel scan of the log.
+inline DialCounts solve_parallel(std::span<const Instruction> instructions, ThreadPool& pool)
+{
+    const auto summary = summarize_parallel(instructions, pool);
+    return {summary.zeros[kDialStart], summary.passes[kDialStart]};
+}
+
+/**
+ * @brief Many independent instruction streams laid out for lane-parallel stepping.
+ *
+ * Structure-of-arrays: remainders[step * stride + dial] is the dial's signed
+ * distance % kDialSize at that step (negative turning left), so one load
+ * fetches the same step of 8 or 16 neighbouring dials. Whole turns only ever
+ * add distance / kDialSize to part 2, so they are summed per dial up front
+ * and the stepping kernel only sees |remainder| < kDialSize. Dials are padded
+ * to a multiple of kDialLanes; a dial's steps past its length are zero and
+ * masked out of the counts.
+ */
+struct DialBatch
+{
+    static constexpr size_t kDialLanes = 16;
+
+    size_t num_dials = 0;
+    size_t stride = 0;
+    size_t num_steps = 0;
+    std::vector<int8_t> remainders;
+    std::vector<int32_t> lengths;
+    std::vector<long long> full_turns;
+};
+
+inline DialBatch make_dial_batch(std::span<const std::span<const Instruction>> streams)
+{
+    AOC_TRACE_SCOPE("day01::make_dial_batch");
+    DialBatch batch;
+    batch.num_dials = streams.size();
+    batch.stride = (streams.size() + DialBatch::kDialLanes - 1) / DialBatch::kDialLanes * DialBatch::kDialLanes;
+    for (const auto& stream : streams)
+    {
+        batch.num_steps = std::max(batch.num_steps, stream.size());
+    }
+    if (batch.num_steps > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+    {
+        throw std::runtime_error("Dial batch stream too long");
+    }
+
+    batch.remainders.assign(batch.num_steps * batch.stride, 0);
+    batch.lengths.assign(batch.stride, 0);
+    batch.full_turns.assign(batch.stride, 0);
+    for (size_t dial = 0; dial < streams.size(); ++dial)
+    {
+        const auto& stream = streams[dial];
+        batch.lengths[dial] = static_cast<int32_t>(stream.size());
+        for (size_t step = 0; step < stream.size(); ++step)
+        {
+            const auto& [rot, val] = stream[step];
+            const int r = val % kDialSize;
+            batch.remainders[step * batch.stride + dial] = static_cast<int8_t>(rot == 'L' ? -r : r);
+            batch.full_turns[dial] += val / kDialSize;
+        }
+    }
+    return batch;
+}
+
+/**
+ * @brief Steps every dial of the batch and returns per-dial part 1/part 2 counts.
+ *
+ * Branchless per lane: with |r| < kDialSize and the position p in
+ * [0, kDialSize), every floor division by kDialSize is -1, 0 or 1 and is
+ * computed by two compares. Turning left counts zeros in [p + r, p - 1] and
+ * turning right in [p + 1, p + r]; shifting both ends down by one when turning
+ * left makes that |fd(p + r - left) - fd(p - left)| for either direction.
+ * Runs 16 dials per AVX-512 vector, 8 per AVX2 vector, or a scalar loop.
+ */
+inline std::vector<DialCounts> run_dial_batch(const DialBatch& batch)
+{
+    AOC_TRACE_SCOPE("day01::run_dial_batch");
+    std::vector<int32_t> zeros(batch.stride, 0);
+    std::vector<int32_t> passes(batch.stride, 0);
+    const int8_t* rem = batch.remainders.data();
+    const size_t steps = batch.num_steps;
+    const size_t stride = batch.stride;
+    size_t g = 0;
+
+#if defined(__AVX512F__)
+    {
+        const __m512i zero = _mm512_setzero_si512();
+        const __m512i one = _mm512_set1_epi32(1);
+        const __m512i c99 = _mm512_set1_epi32(kDialSize - 1);
+        const __m512i c100 = _mm512_set1_epi32(kDialSize);
+        const auto floor_div = [&](__m512i v) {
+            return _mm512_sub_epi32(_mm512_maskz_mov_epi32(_mm512_cmpgt_epi32_mask(v, c99), one),
+                                    _mm512_maskz_mov_epi32(_mm512_cmplt_epi32_mask(v, zero), one));
+        };
+        for (; g + 16 <= stride; g += 16)
+        {
+            __m512i pos = _mm512_set1_epi32(kDialStart);
+            __m512i p1 = zero;
+            __m512i p2 = zero;
+            const __m512i len = _mm512_loadu_si512(batch.lengths.data() + g);
+            for (size_t t = 0; t < steps; ++t)
+            {
+                const __m512i r =
+                    _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rem + t * stride + g)));
+                const __mmask16 active = _mm512_cmpgt_epi32_mask(len, _mm512_set1_epi32(static_cast<int>(t)));
+                const __mmask16 left = _mm512_cmplt_epi32_mask(r, zero);
+
+                __m512i moved = _mm512_add_epi32(pos, r);
+                const __m512i x = _mm512_mask_sub_epi32(moved, left, moved, one);
+                const __m512i y = _mm512_mask_sub_epi32(pos, left, pos, one);
+                const __m512i extra = _mm512_abs_epi32(_mm512_sub_epi32(floor_div(x), floor_div(y)));
+
+                moved = _mm512_mask_sub_epi32(moved, _mm512_cmpgt_epi32_mask(moved, c99), moved, c100);
+                pos = _mm512_mask_add_epi32(moved, _mm512_cmplt_epi32_mask(moved, zero), moved, c100);
+                p1 = _mm512_mask_add_epi32(p1, active & _mm512_cmpeq_epi32_mask(pos, zero), p1, one);
+                p2 = _mm512_mask_add_epi32(p2, active, p2, extra);
+            }
+            _mm512_storeu_si512(zeros.data() + g, p1);
+            _mm512_storeu_si512(passes.data() + g, p2);
+        }
+    }
+#endif
+#if defined(__AVX2__)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i c99 = _mm256_set1_epi32(kDialSize - 1);
+        const __m256i c100 = _mm256_set1_epi32(kDialSize);
+        // Compare masks are -1 where true, so [v < 0] - [v > 99] in masks is fd(v)
+        const auto floor_div = [&](__m256i v) {
+            return _mm256_sub_epi32(_mm256_cmpgt_epi32(zero, v), _mm256_cmpgt_epi32(v, c99));
+        };
+        for (; g + 8 <= stride; g += 8)
+        {
+            __m256i pos = _mm256_set1_epi32(kDialStart);
+            __m256i p1 = zero;
+            __m256i p2 = zero;
+            const __m256i len = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.lengths.data() + g));
+            for (size_t t = 0; t < steps; ++t)
+            {
+                const __m256i r =
+                    _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rem + t * stride + g)));
+                const __m256i active = _mm256_cmpgt_epi32(len, _mm256_set1_epi32(static_cast<int>(t)));
+                const __m256i left = _mm256_cmpgt_epi32(zero, r);
+
+                __m256i moved = _mm256_add_epi32(pos, r);
+                const __m256i x = _mm256_add_epi32(moved, left);
+                const __m256i y = _mm256_add_epi32(pos, left);
+                const __m256i extra = _mm256_abs_epi32(_mm256_sub_epi32(floor_div(x), floor_div(y)));
+
+                moved = _mm256_sub_epi32(moved, _mm256_and_si256(_mm256_cmpgt_epi32(moved, c99), c100));
+                pos = _mm256_add_epi32(moved, _mm256_and_si256(_mm256_cmpgt_epi32(zero, moved), c100));
+                p1 = _mm256_sub_epi32(p1, _mm256_and_si256(active, _mm256_cmpeq_epi32(pos, zero)));
+                p2 = _mm256_add_epi32(p2, _mm256_and_si256(active, extra));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(zeros.data() + g), p1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(passes.data() + g), p2);
+        }
+    }
+#endif
+    const auto floor_div = [](int v) { return static_cast<int>(v > kDialSize - 1) - static_cast<int>(v < 0); };
+    for (; g < stride; ++g)
+    {
+        int pos = kDialStart;
+        for (size_t t = 0; t < steps; ++t)
+        {
+            const int r = rem[t * stride + g];
+            const int active = static_cast<int>(static_cast<int32_t>(t) < batch.lengths[g]);
+            const int left = static_cast<int>(r < 0);
+
+            const int moved = pos + r;
+            const int extra = std::abs(floor_div(moved - left) - floor_div(pos - left));
+            pos = moved - kDialSize * floor_div(moved);
+            zeros[g] += active & static_cast<int>(pos == 0);
+            passes[g] += active & extra;
+        }
+    }
+
+    std::vector<DialCounts> counts(batch.num_dials);
+    for (size_t dial = 0; dial < batch.num_dials; ++dial)
+    {
+        counts[dial] = {zeros[dial], batch.full_turns[dial] + passes[dial]};
+    }
+    return counts;
+}
+
+/**
+ * @brief Both parts' dial state, advanced one instruction at a time.
+ *
+ * Both parts follow the same dial position and differ only in what they count,
+ * so one state serves both. part1 and part2 are equivalent to a Dial fed
+ * the whole instruction list.
+ */
+struct Dial
+{
+    int position = kDialStart;
+    DialCounts counts;
+
+    void turn(char rot, int val)
+    {
+        if (rot == 'L')
+        {
+            counts.part2 += floor_div(position - 1, kDialSize) - floor_div(position - val - 1, kDialSize);
+            position = ((position - val) % kDialSize + kDialSize) % kDialSize;
+        }
+        else
+        {
+            position += val;
+            counts.part2 += position / kDialSize;
+            position %= kDialSize;
+        }
+        counts.part1 += position == 0 ? 1 : 0;
+    }
+
+    /**
+     * @brief Parses "L68\nR48\n..." and turns the dial as it goes.
+     *
+     * text must end on a token boundary (a whole buffer or a whole line). No
+     * Instruction is materialized: each number is accumulated digit by digit
+     * and applied immediately, so the input is read exactly once. Distances
+     * are capped at kMaxDistance, so neither the accumulation nor turn()
+     * can overflow.
+     */
+    void feed(std::string_view text)
+    {
+        const char* p = text.data();
+        const char* const end = p + text.size();
+        while (p < end)
+        {
+            const char* const token = p;
+            const char rot = *p++;
+            if (rot == '\n' || rot == '\r')
+            {
+                continue;
+            }
+            if ((rot != 'L' && rot != 'R') || p == end || static_cast<unsigned>(*p - '0') > 9)
+            {
+                throw_malformed(text, token);
+            }
+
+            int val = 0;
+            while (p < end && static_cast<unsigned>(*p - '0') <= 9)
+            {
+                const int digit = *p++ - '0';
+                if (val > (kMaxDistance - digit) / 10)
+                {
+                    throw_malformed(text, token);
+                }
+                val = val * 10 + digit;
+            }
+            turn(rot, val);
+        }
+    }
+
+  private:
+    static constexpr int kMaxDistance = std::numeric_limits<int>::max() - kDialSize;
+
+    [[noreturn]] static void throw_malformed(std::string_view text, const char* token)
+    {
+        const auto line = text.substr(token - text.data());
+        throw std::runtime_error("Malformed instruction: " + std::string(line.substr(0, line.find('\n'))));
+    }
+};
+
+// Fused parse-and-solve over a whole buffer: one pass, no instruction vector.
+inline DialCounts solve_fused(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day01::solve_fused");
+    Dial dial;
+    dial.feed(content);
+    return dial.counts;
+}
+
+// Fused parse-and-solve over a stream; memory is just the reader's buffer.
+inline DialCounts solve_fused(LineReader& reader)
+{
+    AOC_TRACE_SCOPE("day01::solve_fused_stream");
+    Dial dial;
+    for (auto line : reader)
+    {
+        dial.feed(line);
+    }
+    return dial.counts;
+}
+
+// Both answers from stream_instructions: memory is just the reader's buffer,
+// and each line goes through the regular parse_instruction.
+inline DialCounts solve_stream(LineReader& reader)
+{
+    AOC_TRACE_SCOPE("day01::solve_stream");
+    Dial dial;
+    stream_instructions(reader, [&](const Instruction& instruction) {
+        dial.turn(instruction.turn, instruction.distance);
+    });
+    return dial.counts;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = ArenaBacked<std::pmr::vector<Instruction>>;
+
+    static constexpr int day = 1;
+    static constexpr std::string_view input_path = "puzzles/day01/long.txt";
+
+    static Parsed parse(std::string_view content)
+    {
+        return Parsed([&](auto* resource) { return parse_instructions(content, resource); });
+    }
+    static long long part1(const Parsed& input) { return day01::part1(input.value); }
+    static long long part2(const Parsed& input) { return day01::part2(input.value); }
+};
+
+}  // namespace aoc::day01
@@ -0,0 +1,474 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <numeric>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day02
+{
+
+struct Range
+{
+    long start;
+    long end;
+};
+
+inline std::vector<Range> parse_input(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day02::parse_input");
+    // "start-end,start-end,..." is a flat list of (start, end) pairs
+    const auto [starts, ends] = parse_int_columns<long, 2>(content, "-,\n");
+
+    std::vector<Range> result;
+    result.reserve(starts.size());
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        result.push_back({starts[i], ends[i]});
+    }
+
+    return result;
+}
+
+// Brute-force reference: checks every ID in every range. Kept as the oracle
+// for the closed-form part1/part2 and the allocation-free scans below.
+inline long long part1_brute_force(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part1_brute_force");
+    long long total = 0;
+    for (const auto& range : input)
+    {
+        for (long i = range.start; i <= range.end; ++i)
+        {
+            std::string num_str = std::to_string(i);
+            size_t j = 0;
+            size_t j2 = num_str.size() / 2;
+            if (num_str.size() % 2 != 0)
+            {
+                continue;  // Skip odd-length numbers
+            }
+            while (j2 < num_str.size() && num_str[j] == num_str[j2])
+            {
+                ++j;
+                ++j2;
+            }
+            if (j2 == num_str.size())
+            {
+                total += i;
+            }
+        }
+    }
+    return total;
+}
+
+inline long long part2_brute_force(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part2_brute_force");
+    long long total = 0;
+    std::unordered_set<long> invalid_nums;
+
+    for (const auto& range : input)
+    {
+        std::unordered_map<long, std::unordered_set<std::string>> patterns;
+        for (long i = range.start; i <= range.end; ++i)
+        {
+            std::string num_str = std::to_string(i);
+            size_t half_size = num_str.size() / 2;
+            for (size_t j = 0; j < half_size; ++j)
+            {
+                const auto pattern = num_str.substr(0, j + 1);
+                patterns[i].insert(pattern);
+            }
+        }
+
+        for (long i = range.start; i <= range.end; ++i)
+        {
+            std::string num_str = std::to_string(i);
+            for (const auto& pattern : patterns[i])
+            {
+                size_t pattern_len = pattern.size();
+                if (num_str.size() % pattern_len != 0)
+                {
+                    continue;
+                }
+                size_t num_idx = 0;
+                size_t pattern_idx = 0;
+                bool invalid = false;
+                while (num_idx < num_str.size())
+                {
+                    if (num_str[num_idx] != pattern[pattern_idx])
+                    {
+                        invalid = true;
+                        break;
+                    }
+                    ++num_idx;
+                    pattern_idx = (pattern_idx + 1) % pattern_len;
+                }
+                if (invalid || pattern_idx != 0)
+                {
+                    continue;
+                }
+
+                invalid_nums.insert(i);
+            }
+        }
+    }
+
+    for (const auto& n : invalid_nums)
+    {
+        total += n;
+    }
+    return total;
+}
+
+// ID types the closed-form engine works in: 64-bit for the puzzle, __int128
+// for bounds (and sums) beyond 10^18.
+template <typename T>
+concept IdInt = std::signed_integral<T> || std::same_as<T, __int128>;
+
+// Enough digits for any __int128
+constexpr int kMaxIdDigits = 40;
+
+template <IdInt T>
+constexpr T pow10(int n)
+{
+    T result = 1;
+    for (int i = 0; i < n; ++i)
+    {
+        result *= 10;
+    }
+    return result;
+}
+
+template <IdInt T>
+constexpr int num_digits(T n)
+{
+    int digits = 1;
+    for (; n >= 10; n /= 10)
+    {
+        ++digits;
+    }
+    return digits;
+}
+
+/**
+ * @brief Sum of the length-digit IDs in [first, last] that repeat a period-digit pattern.
+ *
+ * Such an ID is pattern * M with the repunit multiplier
+ * M = 1 + 10^period + 10^(2 period) + ... (e.g. 10101 for period 2 and length 6),
+ * so the IDs in range are M * P for P in [ceil(first / M), floor(last / M)]
+ * and their sum is M times an arithmetic series. Bounds must already lie within
+ * the length-digit numbers; that keeps P within the period-digit patterns.
+ */
+template <IdInt T>
+constexpr T sum_periodic(T first, T last, int length, int period)
+{
+    T multiplier = 0;
+    for (int i = 0; i < length; i += period)
+    {
+        multiplier = multiplier * pow10<T>(period) + 1;
+    }
+
+    const T lo = first / multiplier + (first % multiplier != 0 ? 1 : 0);
+    const T hi = last / multiplier;
+    if (lo > hi)
+    {
+        return 0;
+    }
+    const T count = hi - lo + 1;
+    const T series = count % 2 == 0 ? count / 2 * (lo + hi) : (lo + hi) / 2 * count;
+    return multiplier * series;
+}
+
+enum class Repeats
+{
+    Twice,    // Part 1: the ID is a pattern written exactly twice
+    AtLeast2  // Part 2: the ID is a pattern written two or more times
+};
+
+/**
+ * @brief Sum of the invalid IDs in [first, last] without visiting the valid ones.
+ *
+ * Splits the range by digit count. For Repeats::AtLeast2 an ID can repeat
+ * several periods at once (222222 has periods 1, 2 and 3), and period e
+ * implies period d whenever e divides d. So the sums per proper divisor d of
+ * the length are turned into sums of IDs whose smallest period is exactly d,
+ * by subtracting the exact sums of d's own proper divisors. Those sets are
+ * disjoint, so their totals add up to the union. Cost is O(digits * divisors^2)
+ * per range, independent of its width.
+ */
+template <IdInt T>
+constexpr T sum_invalid_ids(T first, T last, Repeats repeats)
+{
+    T total = 0;
+    first = std::max<T>(first, 1);
+    if (first > last)
+    {
+        return total;
+    }
+
+    const int max_length = num_digits(last);
+    for (int length = num_digits(first); length <= max_length; ++length)
+    {
+        const T lo = std::max(first, pow10<T>(length - 1));
+        const T hi = length < max_length ? pow10<T>(length) - 1 : last;
+
+        if (repeats == Repeats::Twice)
+        {
+            total += length % 2 == 0 ? sum_periodic(lo, hi, length, length / 2) : 0;
+            continue;
+        }
+
+        // exact[d]: sum of IDs whose smallest period is d, for proper divisors d of length
+        std::array<T, kMaxIdDigits> exact{};
+        for (int d = 1; d < length; ++d)
+        {
+            if (length % d != 0)
+            {
+                continue;
+            }
+            exact[d] = sum_periodic(lo, hi, length, d);
+            for (int e = 1; e < d; ++e)
+            {
+                exact[d] -= d % e == 0 ? exact[e] : 0;
+            }
+            total += exact[d];
+        }
+    }
+    return total;
+}
+
+// Overlapping ranges share their IDs: merges them so each ID counts once.
+inline std::vector<Range> merge_overlapping(std::vector<Range> ranges)
+{
+    std::ranges::sort(ranges, {}, &Range::start);
+    std::vector<Range> merged;
+    for (const auto& range : ranges)
+    {
+        if (!merged.empty() && range.start <= merged.back().end)
+        {
+            merged.back().end = std::max(merged.back().end, range.end);
+        }
+        else
+        {
+            merged.push_back(range);
+        }
+    }
+    return merged;
+}
+
+constexpr int kMaxDigits64 = 19;
+
+inline constexpr auto kPow10 = [] {
+    std::array<long long, kMaxDigits64> table{};
+    for (int i = 0; i < kMaxDigits64; ++i)
+    {
+        table[i] = pow10<long long>(i);
+    }
+    return table;
+}();
+
+// Per digit length L, the repunit multipliers 1 + 10^k + ... + 10^(L-k) of the
+// periods k an L-digit ID is tested against. An L-digit ID repeats a k-digit
+// pattern iff it is divisible by that multiplier. Period e implies period d
+// whenever e divides d, so only the maximal proper periods L/p (p a prime
+// factor of L) are needed to decide part 2: e.g. 6 and 4 for length 12.
+struct PeriodMultipliers
+{
+    std::array<long long, 4> maximal{};
+    int count = 0;
+    long long twice = 0;  // Multiplier of period L/2, 0 for odd L
+};
+
+inline constexpr auto kPeriodMultipliers = [] {
+    std::array<PeriodMultipliers, kMaxDigits64 + 1> table{};
+    for (int length = 2; length <= kMaxDigits64; ++length)
+    {
+        auto& entry = table[length];
+        for (int p = 2; p <= length; ++p)
+        {
+            bool prime = true;
+            for (int q = 2; q * q <= p; ++q)
+            {
+                prime = prime && p % q != 0;
+            }
+            if (!prime || length % p != 0)
+            {
+                continue;
+            }
+
+            const int period = length / p;
+            long long multiplier = 0;
+            for (int i = 0; i < length; i += period)
+            {
+                multiplier = multiplier * kPow10[period] + 1;
+            }
+            entry.maximal[entry.count++] = multiplier;
+            entry.twice = p == 2 ? multiplier : entry.twice;
+        }
+    }
+    return table;
+}();
+
+// Tests a length-digit ID with one modulo per candidate period; no digit strings.
+constexpr bool has_repeated_pattern(long long id, int length, Repeats repeats)
+{
+    const auto& entry = kPeriodMultipliers[length];
+    if (repeats == Repeats::Twice)
+    {
+        return entry.twice != 0 && id % entry.twice == 0;
+    }
+    for (int i = 0; i < entry.count; ++i)
+    {
+        if (id % entry.maximal[i] == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Sums the invalid IDs of [first, last] by testing each one; tracks the digit
+// length across the range instead of recomputing it per ID.
+constexpr long long scan_invalid_ids(long long first, long long last, Repeats repeats)
+{
+    long long total = 0;
+    long long id = std::max<long long>(first, 1);
+    for (int length = num_digits(id); id <= last; ++length)
+    {
+        const long long length_end = length < kMaxDigits64 ? std::min(last, kPow10[length] - 1) : last;
+        for (; id <= length_end; ++id)
+        {
+            total += has_repeated_pattern(id, length, repeats) ? id : 0;
+        }
+    }
+    return total;
+}
+
+// Per-ID scans with the allocation-free checker: O(width) like the brute-force
+// oracle, but a modulo or two per ID instead of strings and hash sets.
+inline long long part1_scan(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part1_scan");
+    long long total = 0;
+    for (const auto& range : input)
+    {
+        total += scan_invalid_ids(range.start, range.end, Repeats::Twice);
+    }
+    return total;
+}
+
+inline long long part2_scan(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part2_scan");
+    long long total = 0;
+    for (const auto& range : merge_overlapping(input))
+    {
+        total += scan_invalid_ids(range.start, range.end, Repeats::AtLeast2);
+    }
+    return total;
+}
+
+/**
+ * @brief Sums sum_chunk(first, last) over every ID of the ranges, on a pool.
+ *
+ * Widths vary wildly (one range may hold nearly all the work), so ranges are
+ * cut into fixed-size chunks rather than handed out whole. One task per worker
+ * keeps claiming the next chunk off a shared atomic cursor until none remain,
+ * so a worker that finishes early takes over the rest of a wide range instead
+ * of idling. Each worker keeps its own partial sum; the partials are added in
+ * worker order at the end, and integer addition makes that deterministic.
+ */
+template <typename F>
+    requires std::invocable<F&, long long, long long>
+long long parallel_sum_ranges(std::span<const Range> ranges, ThreadPool& pool, F&& sum_chunk,
+                              long long chunk_size = 1 << 16)
+{
+    // chunk_offsets[i]: number of chunks in ranges before i
+    std::vector<size_t> chunk_offsets(ranges.size() + 1, 0);
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        const long long width = std::max<long long>(0, ranges[i].end - ranges[i].start + 1);
+        chunk_offsets[i + 1] = chunk_offsets[i] + static_cast<size_t>((width + chunk_size - 1) / chunk_size);
+    }
+    const size_t num_chunks = chunk_offsets.back();
+
+    std::atomic<size_t> next_chunk{0};
+    std::vector<long long> partial(pool.size(), 0);
+    parallel_for(pool, partial.size(), [&](size_t worker) {
+        long long sum = 0;
+        for (size_t c = next_chunk++; c < num_chunks; c = next_chunk++)
+        {
+            const auto i = static_cast<size_t>(std::ranges::upper_bound(chunk_offsets, c) - chunk_offsets.begin() - 1);
+            const long long first = ranges[i].start + static_cast<long long>(c - chunk_offsets[i]) * chunk_size;
+            sum += sum_chunk(first, std::min<long long>(ranges[i].end, first + chunk_size - 1));
+        }
+        partial[worker] = sum;
+    });
+
+    return std::accumulate(partial.begin(), partial.end(), 0LL);
+}
+
+// Parallel versions of the per-ID scans.
+inline long long part1_scan(const std::vector<Range>& input, ThreadPool& pool)
+{
+    AOC_TRACE_SCOPE("day02::part1_scan_parallel");
+    return parallel_sum_ranges(input, pool, [](long long first, long long last) {
+        return scan_invalid_ids(first, last, Repeats::Twice);
+    });
+}
+
+inline long long part2_scan(const std::vector<Range>& input, ThreadPool& pool)
+{
+    AOC_TRACE_SCOPE("day02::part2_scan_parallel");
+    return parallel_sum_ranges(merge_overlapping(input), pool, [](long long first, long long last) {
+        return scan_invalid_ids(first, last, Repeats::AtLeast2);
+    });
+}
+
+inline long long part1(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part1");
+    long long total = 0;
+    for (const auto& range : input)
+    {
+        total += sum_invalid_ids<long long>(range.start, range.end, Repeats::Twice);
+    }
+    return total;
+}
+
+// Part 2 collects IDs in a set across ranges, so overlaps are merged first.
+inline long long part2(const std::vector<Range>& input)
+{
+    AOC_TRACE_SCOPE("day02::part2");
+    long long total = 0;
+    for (const auto& range : merge_overlapping(input))
+    {
+        total += sum_invalid_ids<long long>(range.start, range.end, Repeats::AtLeast2);
+    }
+    return total;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = std::vector<Range>;
+
+    static constexpr int day = 2;
+    static constexpr std::string_view input_path = "puzzles/day02/long.txt";
+
+    static Parsed parse(std::string_view content) { return parse_input(content); }
+    static long long part1(const Parsed& input) { return day02::part1(input); }
+    static long long part2(const Parsed& input) { return day02::part2(input); }
+};
+
+}  // namespace aoc::day02
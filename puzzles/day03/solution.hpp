@@ -0,0 +1,437 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day03
+{
+
+template <typename T>
+concept MemoTable = requires(T memo, size_t i, size_t j) {
+    { memo(i, j) } -> std::convertible_to<long long&>;  // 2D access
+};
+
+class Matrix
+{
+  private:
+    std::vector<long long> data;
+    size_t cols_;
+
+  public:
+    // Matrix provides 2D access to a flat contiguous vector for better cache
+    // performance compared to std::vector<std::vector<>> which has scattered
+    // allocations.
+    Matrix(size_t rows, size_t cols) : data(rows * cols, -1), cols_(cols) {}
+
+    // Reshapes and refills with -1, reusing the existing allocation when it is
+    // large enough: a Matrix kept across calls grows but is never freed.
+    void reset(size_t rows, size_t cols)
+    {
+        data.assign(rows * cols, -1);
+        cols_ = cols;
+    }
+    long long& operator()(size_t i, size_t j) { return data[i * cols_ + j]; }
+    const long long& operator()(size_t i, size_t j) const { return data[i * cols_ + j]; }
+};
+
+constexpr int to_digit(char c)
+{
+    assert(c >= '0' && c <= '9' && "Character must be a digit");
+    return c - '0';
+}
+
+// Powers of ten up to the largest that fits in long long.
+inline constexpr auto kPow10 = [] {
+    std::array<long long, std::numeric_limits<long long>::digits10 + 1> table{};
+    table[0] = 1;
+    for (size_t i = 1; i < table.size(); ++i)
+    {
+        table[i] = table[i - 1] * 10;
+    }
+    return table;
+}();
+
+// Memo table in a fixed-size std::array, for lines of at most MaxRows - 1
+// digits: no heap allocation, and only the rows x cols prefix is initialized.
+template <size_t MaxRows, size_t MaxCols>
+class ArrayMemo
+{
+  private:
+    std::array<long long, MaxRows * MaxCols> data;
+    size_t cols_;
+
+  public:
+    ArrayMemo(size_t rows, size_t cols) : cols_(cols)
+    {
+        assert(rows <= MaxRows && cols <= MaxCols && "Table exceeds the fixed capacity");
+        std::fill_n(data.begin(), rows * cols, -1);
+    }
+    long long& operator()(size_t i, size_t j) { return data[i * cols_ + j]; }
+    const long long& operator()(size_t i, size_t j) const { return data[i * cols_ + j]; }
+};
+
+// Slot count of a KnapsackSolver that takes it at runtime.
+inline constexpr size_t kRuntimeSlots = 0;
+
+/**
+ * @brief Digit-selection knapsack, optionally specialized on the slot count.
+ *
+ * KnapsackSolver<k> for a fixed k runs a bottom-up kernel whose k updates per
+ * digit are unrolled at compile time into straight-line integer code, with no
+ * memo table at all. KnapsackSolver<> (kRuntimeSlots) takes k per call and runs
+ * the memoized recursion, in a stack ArrayMemo for short lines and in a reused
+ * heap Matrix otherwise.
+ */
+template <size_t NumSlots = kRuntimeSlots>
+class KnapsackSolver
+{
+  public:
+    static constexpr size_t kStackMemoRows = 128;
+
+    /**
+     * @brief Solves digit selection knapsack problem.
+     *
+     * Given a string of digits and a number of slots, selects digits to maximize
+     * the resulting number. Each digit contributes: digit * 10^(remaining_slots-1)
+     *
+     * Algorithm: DP with memoization
+     * - State: (index, slots_remaining)
+     * - Decision: include or exclude current digit
+     * - Optimization: Memoize to avoid recomputation
+     *
+     * Complexity: O(n * s) where n = string length, s = num_slots
+     */
+    template <MemoTable M>
+    long long digit_knapsack(size_t idx, std::string_view nums, int num_slots, M& memo)
+    {
+        if (idx >= nums.size() || num_slots <= 0)
+        {
+            return 0;
+        }
+        if (memo(idx, num_slots) != -1)
+        {
+            return memo(idx, num_slots);
+        }
+        int digit = to_digit(nums[idx]);
+        long long val = kPow10[std::min(num_slots - 1, static_cast<int>(nums.size() - idx - 1))] * digit;
+
+        long long include = val + digit_knapsack(idx + 1, nums, num_slots - 1, memo);
+        long long exclude = digit_knapsack(idx + 1, nums, num_slots, memo);
+        memo(idx, num_slots) = std::max(include, exclude);
+        return memo(idx, num_slots);
+    }
+
+    // Reuses the solver's memo table across lines, so keep one solver per thread.
+    long long solve_line(const std::string_view line, const size_t num_slots = NumSlots)
+    {
+        if constexpr (NumSlots != kRuntimeSlots)
+        {
+            assert(num_slots == NumSlots && "Slot count is fixed by the template argument");
+            return select_unrolled(line);
+        }
+
+        size_t n = line.size();
+        if (n < kStackMemoRows && num_slots < kPow10.size() + 1)
+        {
+            ArrayMemo<kStackMemoRows, kPow10.size() + 1> memo(n + 1, num_slots + 1);
+            return digit_knapsack(0, line, num_slots, memo);
+        }
+        memo_.reset(n + 1, num_slots + 1);
+        return digit_knapsack(0, line, num_slots, memo_);
+    }
+
+    /**
+     * @brief Bottom-up form of the same DP for a compile-time slot count.
+     *
+     * best[j] is the largest number made of j digits chosen from the digits
+     * seen so far (-1 while fewer than j have been seen). Each digit d updates
+     * best[j] = max(best[j], best[j - 1] * 10 + d) for j = NumSlots..1; the fold
+     * over an index_sequence unrolls those NumSlots updates.
+     */
+    static long long select_unrolled(std::string_view line)
+        requires(NumSlots != kRuntimeSlots)
+    {
+        std::array<long long, NumSlots + 1> best;
+        best.fill(-1);
+        best[0] = 0;
+
+        for (char c : line)
+        {
+            const int digit = to_digit(c);
+            const auto update = [&](size_t j) {
+                const long long take = best[j - 1] < 0 ? -1 : best[j - 1] * 10 + digit;
+                best[j] = std::max(best[j], take);
+            };
+            [&]<size_t... J>(std::index_sequence<J...>) { (update(NumSlots - J), ...); }(
+                std::make_index_sequence<NumSlots>{});
+        }
+        return best[std::min(line.size(), NumSlots)];
+    }
+
+  private:
+    Matrix memo_{0, 0};
+};
+
+// Most digits a T can hold without overflow: 18 for long long, 38 for __int128.
+template <typename T>
+constexpr size_t kMaxSlots = std::same_as<T, __int128> ? 38 : std::numeric_limits<T>::digits10;
+
+/**
+ * @brief Largest number formed by keeping num_slots digits of line, in order.
+ *
+ * Greedy with a monotonic stack capped at num_slots entries: each digit pops
+ * smaller digits off the top as long as the digits left after it can still
+ * fill the stack, then is pushed if there is room. Every digit is pushed and
+ * popped at most once, so this is O(n) time and O(num_slots) memory with no
+ * recursion, which suits lines of millions of digits. Like the DP, lines
+ * shorter than num_slots keep every digit.
+ */
+template <typename T = long long>
+T select_max_digits(std::string_view line, size_t num_slots)
+{
+    if (num_slots > kMaxSlots<T>)
+    {
+        throw std::invalid_argument("Too many slots for the result type: " + std::to_string(num_slots));
+    }
+
+    std::array<char, kMaxSlots<T>> stack;
+    size_t top = 0;
+    const size_t n = line.size();
+    for (size_t i = 0; i < n; ++i)
+    {
+        const char c = line[i];
+        while (top > 0 && stack[top - 1] < c && top - 1 + (n - i) >= num_slots)
+        {
+            --top;
+        }
+        if (top < num_slots)
+        {
+            stack[top++] = c;
+        }
+    }
+
+    T result = 0;
+    for (size_t i = 0; i < top; ++i)
+    {
+        result = result * 10 + to_digit(stack[i]);
+    }
+    return result;
+}
+
+/**
+ * @brief Sparse table answering "leftmost largest digit in [first, last]" in O(1).
+ *
+ * Level j stores, for every start i, the position of the leftmost maximum of
+ * the 2^j digits starting at i; a query takes the better of two overlapping
+ * power-of-two windows. Setup is O(n log n) time and memory, after which the
+ * greedy k-digit selection costs O(k) for any k, so many k on one line share
+ * a single preprocessing pass.
+ */
+class DigitRangeMax
+{
+  public:
+    explicit DigitRangeMax(std::string_view line) : line_(line), n_(line.size())
+    {
+        const size_t levels = n_ == 0 ? 0 : std::bit_width(n_);
+        table_.resize(levels * n_);
+        for (size_t i = 0; i < n_; ++i)
+        {
+            table_[i] = static_cast<uint32_t>(i);
+        }
+        for (size_t level = 1; level < levels; ++level)
+        {
+            const size_t half = size_t{1} << (level - 1);
+            const uint32_t* prev = table_.data() + (level - 1) * n_;
+            uint32_t* cur = table_.data() + level * n_;
+            for (size_t i = 0; i + 2 * half <= n_; ++i)
+            {
+                cur[i] = better(prev[i], prev[i + half]);
+            }
+        }
+    }
+
+    // Position of the leftmost largest digit in [first, last] (inclusive).
+    size_t argmax(size_t first, size_t last) const
+    {
+        const size_t level = std::bit_width(last - first + 1) - 1;
+        const uint32_t* row = table_.data() + level * n_;
+        return better(row[first], row[last + 1 - (size_t{1} << level)]);
+    }
+
+    // Greedy selection: the i-th chosen digit is the leftmost maximum among
+    // those that still leave enough digits after it for the remaining slots.
+    template <typename T = long long>
+    T select(size_t num_slots) const
+    {
+        const size_t k = std::min(num_slots, n_);
+        T result = 0;
+        size_t next = 0;
+        for (size_t i = 0; i < k; ++i)
+        {
+            const size_t pos = argmax(next, n_ - k + i);
+            result = result * 10 + to_digit(line_[pos]);
+            next = pos + 1;
+        }
+        return result;
+    }
+
+  private:
+    std::string_view line_;
+    size_t n_;
+    std::vector<uint32_t> table_;  // levels x n, row-major
+
+    uint32_t better(uint32_t a, uint32_t b) const { return line_[b] > line_[a] ? b : a; }
+};
+
+/**
+ * @brief Best selection for every k from 1 to min(n, max_k), in one call.
+ *
+ * result[k - 1] is the answer for k slots. k is capped at what T can hold
+ * (18 digits for long long, 38 for __int128).
+ */
+template <typename T = long long>
+std::vector<T> solve_line_all_k(std::string_view line, size_t max_k = kMaxSlots<T>)
+{
+    if (max_k > kMaxSlots<T>)
+    {
+        throw std::invalid_argument("Too many slots for the result type: " + std::to_string(max_k));
+    }
+
+    const DigitRangeMax index(line);
+    std::vector<T> result(std::min(line.size(), max_k));
+    for (size_t k = 1; k <= result.size(); ++k)
+    {
+        result[k - 1] = index.select<T>(k);
+    }
+    return result;
+}
+
+enum class Backend
+{
+    MonotonicStack,  // Default: O(n) greedy
+    Knapsack,        // Memoized DP, kept to cross-check the greedy engine
+    Unrolled         // Bottom-up DP unrolled for k = 2 and 12; Knapsack for other k
+};
+
+// Sums one block of whole lines; solver carries the caller's reusable scratch.
+template <typename T = long long>
+T solve_lines(std::string_view content, size_t num_slots, Backend backend, KnapsackSolver<>& solver)
+{
+    T sum = 0;
+
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        if (backend == Backend::MonotonicStack)
+        {
+            sum += select_max_digits<T>(line, num_slots);
+        }
+        else if (backend == Backend::Unrolled && num_slots == 2)
+        {
+            sum += KnapsackSolver<2>::select_unrolled(line);
+        }
+        else if (backend == Backend::Unrolled && num_slots == 12)
+        {
+            sum += KnapsackSolver<12>::select_unrolled(line);
+        }
+        else
+        {
+            sum += solver.solve_line(line, num_slots);
+        }
+    }
+
+    return sum;
+}
+
+inline void check_backend(size_t num_slots, Backend backend)
+{
+    if (backend != Backend::MonotonicStack && num_slots > kMaxSlots<long long>)
+    {
+        throw std::invalid_argument("The knapsack backends are limited to 64-bit results");
+    }
+}
+
+template <typename T = long long>
+T solve(std::string_view content, size_t num_slots, Backend backend = Backend::MonotonicStack)
+{
+    check_backend(num_slots, backend);
+    KnapsackSolver<> solver;
+    return solve_lines<T>(content, num_slots, backend, solver);
+}
+
+/**
+ * @brief Line-parallel solve().
+ *
+ * Lines are independent, so the content is cut at newline boundaries into a
+ * few blocks per worker. One task per worker claims blocks off a shared
+ * cursor with its own KnapsackSolver, whose memo table grows to the longest
+ * line it has seen and is then reused for every later line. Partial sums are
+ * reduced in worker order at the end.
+ */
+template <typename T = long long>
+T solve_parallel(std::string_view content, size_t num_slots, ThreadPool& pool,
+                 Backend backend = Backend::MonotonicStack)
+{
+    AOC_TRACE_SCOPE("day03::solve_parallel");
+    check_backend(num_slots, backend);
+    const auto blocks = split_line_aligned(content, pool.size() * 8);
+
+    std::atomic<size_t> next_block{0};
+    std::vector<T> partial(pool.size(), 0);
+    parallel_for(pool, partial.size(), [&](size_t worker) {
+        KnapsackSolver<> solver;
+        T sum = 0;
+        for (size_t b = next_block++; b < blocks.size(); b = next_block++)
+        {
+            sum += solve_lines<T>(blocks[b], num_slots, backend, solver);
+        }
+        partial[worker] = sum;
+    });
+
+    return std::accumulate(partial.begin(), partial.end(), T{0});
+}
+
+inline long long part1(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day03::part1");
+    return solve(content, 2);
+}
+
+inline long long part2(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day03::part2");
+    return solve(content, 12);
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = std::string_view;
+
+    static constexpr int day = 3;
+    static constexpr std::string_view input_path = "puzzles/day03/long.txt";
+
+    static Parsed parse(std::string_view content) { return content; }
+    static long long part1(const Parsed& input) { return day03::part1(input); }
+    static long long part2(const Parsed& input) { return day03::part2(input); }
+};
+
+}  // namespace aoc::day03
@@ -0,0 +1,470 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day04
+{
+
+constexpr std::array<std::pair<int, int>, 8> DIRECTIONS = {{
+    {0, 1},    // right
+    {1, 0},    // down
+    {1, 1},    // down-right
+    {1, -1},   // down-left
+    {0, -1},   // left
+    {-1, 0},   // up
+    {-1, -1},  // up-left
+    {-1, 1}    // up-right
+}};
+
+/**
+ * @brief One bit per '@' cell, 64 cells per word.
+ *
+ * Bit j of word w in a row is column 64 * w + j. Every row carries a zero
+ * guard word on each side and the grid has a zero guard row above and below,
+ * so neighbor words can be read without bounds checks.
+ */
+struct BitGrid
+{
+    int rows = 0;
+    int cols = 0;
+    size_t words_per_row = 0;
+    size_t stride = 0;  // words_per_row plus the two guard words
+    std::vector<uint64_t> words;
+
+    BitGrid() = default;
+    BitGrid(int num_rows, int num_cols)
+        : rows(num_rows),
+          cols(num_cols),
+          words_per_row((static_cast<size_t>(num_cols) + 63) / 64),
+          stride(words_per_row + 2),
+          words(static_cast<size_t>(num_rows + 2) * stride, 0)
+    {
+    }
+
+    // First real word of row r; r may be -1 or rows (the guard rows).
+    uint64_t* row(int r) { return words.data() + static_cast<size_t>(r + 1) * stride + 1; }
+    const uint64_t* row(int r) const { return words.data() + static_cast<size_t>(r + 1) * stride + 1; }
+
+    bool test(int r, int c) const { return (row(r)[c / 64] >> (c % 64)) & 1; }
+
+    // Packs one text row, 32 bytes per compare and movemask where available.
+    void pack_row(int r, std::string_view line)
+    {
+        uint64_t* out = row(r);
+        const size_t n = std::min(line.size(), static_cast<size_t>(cols));
+        size_t c = 0;
+#if defined(__AVX2__)
+        const __m256i roll = _mm256_set1_epi8('@');
+        for (; c + 64 <= n; c += 64)
+        {
+            const auto* p = reinterpret_cast<const __m256i*>(line.data() + c);
+            const auto lo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(p), roll)));
+            const auto hi =
+                static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(p + 1), roll)));
+            out[c / 64] = lo | (static_cast<uint64_t>(hi) << 32);
+        }
+#endif
+        for (; c < n; ++c)
+        {
+            out[c / 64] |= static_cast<uint64_t>(line[c] == '@') << (c % 64);
+        }
+    }
+};
+
+// Padded char grid ('.' border) plus its bit-packed '@' cells.
+struct Grid : aoc::Grid<char>
+{
+    BitGrid bits;
+
+    Grid(std::string_view content) : aoc::Grid<char>(aoc::Grid<char>::from_text(content, '.'))
+    {
+        AOC_TRACE_SCOPE("day04::parse_grid");
+        bits = BitGrid(rows, cols);
+        for (int i = 0; i < rows; ++i)
+        {
+            bits.pack_row(i, std::string_view(&(*this)(i, 0), cols));
+        }
+    }
+};
+
+// Cell-by-cell reference for part1.
+inline int part1_scalar(const Grid& grid)
+{
+    AOC_TRACE_SCOPE("day04::part1_scalar");
+    int num_accessible = 0;
+    for (int i = 0; i < grid.rows; ++i)
+    {
+        for (int j = 0; j < grid.cols; ++j)
+        {
+            if (grid(i, j) == '.')
+            {
+                continue;
+            }
+            // The '.' border stands in for neighbors outside the grid
+            int num_papers = 0;
+            for (const auto& [di, dj] : DIRECTIONS)
+            {
+                if (grid(i + di, j + dj) == '@')
+                {
+                    ++num_papers;
+                }
+            }
+            if (num_papers < 4)
+            {
+                ++num_accessible;
+            }
+        }
+    }
+    return num_accessible;
+}
+
+/**
+ * @brief Per-bit masks of the cells with fewer than 4 occupied neighbors.
+ *
+ * Bit-sliced: the eight neighbor masks of a word (the row above and below
+ * shifted west, unshifted and shifted east, plus this row shifted west and
+ * east) are added into a per-bit counter, 64 cells at a time. Only "fewer than
+ * 4" matters, so the counter is two sum bits plus a sticky "reached 4" bit.
+ * f(r, w, mask) receives the mask of row r, word w for rows in
+ * [first_row, last_row); cells that are empty or outside the grid may be set
+ * in it and must be masked out by the caller. Rows just outside the range are
+ * read as halo, so disjoint row bands can be evaluated concurrently.
+ */
+template <typename F>
+void for_each_sparse_word(const BitGrid& grid, int first_row, int last_row, F&& f)
+{
+    const size_t wpr = grid.words_per_row;
+    for (int r = first_row; r < last_row; ++r)
+    {
+        const uint64_t* above = grid.row(r - 1);
+        const uint64_t* cur = grid.row(r);
+        const uint64_t* below = grid.row(r + 1);
+        for (size_t w = 0; w < wpr; ++w)
+        {
+            const auto west = [w](const uint64_t* p) { return (p[w] << 1) | (p[w - 1] >> 63); };
+            const auto east = [w](const uint64_t* p) { return (p[w] >> 1) | (p[w + 1] << 63); };
+            const std::array<uint64_t, 8> neighbors = {west(above), above[w], east(above), west(cur),
+                                                       east(cur),   west(below), below[w], east(below)};
+
+            uint64_t s0 = 0;
+            uint64_t s1 = 0;
+            uint64_t at_least_4 = 0;
+            for (uint64_t m : neighbors)
+            {
+                const uint64_t c0 = s0 & m;
+                s0 ^= m;
+                at_least_4 |= s1 & c0;
+                s1 ^= c0;
+            }
+            f(r, w, ~at_least_4);
+        }
+    }
+}
+
+inline int part1(const Grid& grid)
+{
+    AOC_TRACE_SCOPE("day04::part1");
+    int num_accessible = 0;
+    for_each_sparse_word(grid.bits, 0, grid.rows, [&](int r, size_t w, uint64_t sparse) {
+        num_accessible += std::popcount(grid.bits.row(r)[w] & sparse);
+    });
+    return num_accessible;
+}
+
+// Rows [first, last) of band b out of num_bands near-equal bands.
+inline std::pair<int, int> row_band(int rows, size_t b, size_t num_bands)
+{
+    const auto bound = [&](size_t i) { return static_cast<int>(static_cast<long long>(rows) * i / num_bands); };
+    return {bound(b), bound(b + 1)};
+}
+
+// part1 over row bands on a pool; each band reads its neighbors' edge rows as halo.
+inline long long part1_parallel(const Grid& grid, ThreadPool& pool)
+{
+    AOC_TRACE_SCOPE("day04::part1_parallel");
+    const size_t num_bands = std::max<size_t>(1, std::min<size_t>(pool.size() * 4, grid.rows));
+    std::vector<long long> partial(num_bands, 0);
+    parallel_for(pool, num_bands, [&](size_t b) {
+        const auto [first, last] = row_band(grid.rows, b, num_bands);
+        for_each_sparse_word(grid.bits, first, last, [&](int r, size_t w, uint64_t sparse) {
+            partial[b] += std::popcount(grid.bits.row(r)[w] & sparse);
+        });
+    });
+    return std::accumulate(partial.begin(), partial.end(), 0LL);
+}
+
+// Rolls outside the grid read as the '.' border, so no bounds checks.
+inline void dfs(aoc::Grid<char>& grid, int x, int y, int& num_removed)
+{
+    if (grid(x, y) == '.' || grid(x, y) == 'x')
+    {
+        return;
+    }
+
+    const auto is_removable = [&]() {
+        int num_papers = 0;
+        for (const auto& [di, dj] : DIRECTIONS)
+        {
+            if (grid(x + di, y + dj) == '@')
+            {
+                ++num_papers;
+            }
+        }
+        return num_papers < 4;
+    };
+
+    if (is_removable())
+    {
+        grid(x, y) = 'x';
+        ++num_removed;
+        for (const auto& [di, dj] : DIRECTIONS)
+        {
+            dfs(grid, x + di, y + dj, num_removed);
+        }
+    }
+}
+
+// Recursive reference for part2.
+inline int part2_dfs(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day04::part2_dfs");
+    auto grid = aoc::Grid<char>::from_text(content, '.');
+
+    int num_removed = 0;
+    for (int i = 0; i < grid.rows; ++i)
+    {
+        for (int j = 0; j < grid.cols; ++j)
+        {
+            if (grid(i, j) == '.' || grid(i, j) == 'x')
+            {
+                continue;
+            }
+            dfs(grid, i, j, num_removed);
+        }
+    }
+    return num_removed;
+}
+
+struct PeelResult
+{
+    long long removed = 0;
+    std::vector<long long> removed_per_round;  // Round 0 is the cells removable from the start
+};
+
+/**
+ * @brief Per-cell state of a peel, in a byte grid with a one-cell empty border.
+ *
+ * The border makes neighbors fixed offsets with no bounds checks. The low bits
+ * of each byte hold the count of neighbors not yet removed, kRoll marks a cell
+ * that started as a roll and kAlive one that is still present and not yet
+ * queued. Only kRoll cells have their counts decremented, and a count only
+ * drops once per removed neighbor, so it never underflows into the flags.
+ */
+struct PeelCells
+{
+    static constexpr uint8_t kAlive = 0x80;
+    static constexpr uint8_t kRoll = 0x40;
+    static constexpr uint8_t kCountMask = 0x0F;
+
+    aoc::Grid<uint8_t> cells;
+    std::array<std::ptrdiff_t, 8> offsets;
+
+    explicit PeelCells(const Grid& grid)
+        : cells(grid.rows, grid.cols), offsets(cells.neighbor_offsets(kAllNeighbors))
+    {
+    }
+
+    int index(int r, int c) const { return static_cast<int>(cells.index(r, c)); }
+
+    // Cell at a flat index, as stored in the peel queues.
+    uint8_t& operator[](std::ptrdiff_t i) { return cells.cells[i]; }
+
+    // Initial counts of rows [first_row, last_row), read from the immutable
+    // padded grid so that bands can be filled concurrently.
+    void count_rows(const Grid& grid, int first_row, int last_row)
+    {
+        for (int r = first_row; r < last_row; ++r)
+        {
+            for (int c = 0; c < grid.cols; ++c)
+            {
+                if (grid(r, c) != '@')
+                {
+                    continue;
+                }
+                int count = 0;
+                for (const auto& [dr, dc] : DIRECTIONS)
+                {
+                    count += grid(r + dr, c + dc) == '@' ? 1 : 0;
+                }
+                cells(r, c) = kAlive | kRoll | static_cast<uint8_t>(count);
+            }
+        }
+    }
+
+    // Appends the cells of rows [first_row, last_row) that are removable from the start.
+    void queue_initial(const Grid& grid, int first_row, int last_row, int min_neighbors, std::vector<int>& queue)
+    {
+        for (int r = first_row; r < last_row; ++r)
+        {
+            for (int c = 0; c < grid.cols; ++c)
+            {
+                uint8_t& cell = cells(r, c);
+                if ((cell & kAlive) && (cell & kCountMask) < min_neighbors)
+                {
+                    cell &= ~kAlive;
+                    queue.push_back(index(r, c));
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief Repeatedly removes rolls with fewer than min_neighbors rolls around them.
+ *
+ * This is k-core peeling on the grid's 8-neighbor graph. Neighbor counts are
+ * computed once; removing a cell decrements its live neighbors, and a
+ * neighbor whose count drops below min_neighbors is appended to one flat
+ * queue. Each cell is queued at most once, so the whole peel is O(cells) with
+ * no recursion. The queue is consumed in rounds: round i + 1 holds the cells
+ * that became removable because of round i's removals.
+ */
+inline PeelResult peel(const Grid& grid, int min_neighbors = 4)
+{
+    AOC_TRACE_SCOPE("day04::peel");
+    PeelCells state(grid);
+    state.count_rows(grid, 0, grid.rows);
+
+    std::vector<int> queue;
+    state.queue_initial(grid, 0, grid.rows, min_neighbors, queue);
+
+    PeelResult result;
+    size_t head = 0;
+    while (head < queue.size())
+    {
+        const size_t round_end = queue.size();
+        result.removed_per_round.push_back(static_cast<long long>(round_end - head));
+        for (; head < round_end; ++head)
+        {
+            for (std::ptrdiff_t offset : state.offsets)
+            {
+                uint8_t& neighbor = state[queue[head] + offset];
+                if (!(neighbor & PeelCells::kAlive))
+                {
+                    continue;
+                }
+                --neighbor;
+                if ((neighbor & PeelCells::kCountMask) < min_neighbors)
+                {
+                    neighbor &= ~PeelCells::kAlive;
+                    queue.push_back(static_cast<int>(queue[head] + offset));
+                }
+            }
+        }
+    }
+
+    result.removed = static_cast<long long>(queue.size());
+    return result;
+}
+
+/**
+ * @brief peel() with each round's frontier processed in parallel.
+ *
+ * Counts and the initial frontier are built per row band. Each round then
+ * splits the frontier into slices; a worker decrements the neighbors of its
+ * cells with atomic fetch_sub, and the single decrement that takes a live
+ * count from min_neighbors to min_neighbors - 1 claims that neighbor for the
+ * next round in the worker's own buffer. Buffers are concatenated in slice
+ * order. The rounds are the same sets as in peel(), so the total and the
+ * per-round counts match the serial engine exactly.
+ */
+inline PeelResult peel_parallel(const Grid& grid, ThreadPool& pool, int min_neighbors = 4)
+{
+    AOC_TRACE_SCOPE("day04::peel_parallel");
+    constexpr size_t kMinCellsPerTask = 4096;
+    PeelCells state(grid);
+
+    const size_t num_bands = std::max<size_t>(1, std::min<size_t>(pool.size() * 4, grid.rows));
+    std::vector<std::vector<int>> local(num_bands);
+    parallel_for(pool, num_bands, [&](size_t b) {
+        const auto [first, last] = row_band(grid.rows, b, num_bands);
+        state.count_rows(grid, first, last);
+    });
+    parallel_for(pool, num_bands, [&](size_t b) {
+        const auto [first, last] = row_band(grid.rows, b, num_bands);
+        state.queue_initial(grid, first, last, min_neighbors, local[b]);
+    });
+
+    const auto gather = [&](size_t num_buffers) {
+        std::vector<int> frontier;
+        for (size_t t = 0; t < num_buffers; ++t)
+        {
+            frontier.insert(frontier.end(), local[t].begin(), local[t].end());
+            local[t].clear();
+        }
+        return frontier;
+    };
+
+    PeelResult result;
+    for (auto frontier = gather(num_bands); !frontier.empty();)
+    {
+        result.removed += static_cast<long long>(frontier.size());
+        result.removed_per_round.push_back(static_cast<long long>(frontier.size()));
+
+        const size_t num_tasks = std::clamp<size_t>(frontier.size() / kMinCellsPerTask, 1, num_bands);
+        parallel_for(pool, num_tasks, [&](size_t t) {
+            const size_t first = frontier.size() * t / num_tasks;
+            const size_t last = frontier.size() * (t + 1) / num_tasks;
+            for (size_t i = first; i < last; ++i)
+            {
+                for (std::ptrdiff_t offset : state.offsets)
+                {
+                    std::atomic_ref<uint8_t> neighbor(state[frontier[i] + offset]);
+                    if (!(neighbor.load(std::memory_order_relaxed) & PeelCells::kRoll))
+                    {
+                        continue;
+                    }
+                    const uint8_t old = neighbor.fetch_sub(1, std::memory_order_relaxed);
+                    if ((old & PeelCells::kAlive) && (old & PeelCells::kCountMask) == min_neighbors)
+                    {
+                        neighbor.fetch_and(static_cast<uint8_t>(~PeelCells::kAlive), std::memory_order_relaxed);
+                        local[t].push_back(static_cast<int>(frontier[i] + offset));
+                    }
+                }
+            }
+        });
+        frontier = gather(num_tasks);
+    }
+    return result;
+}
+
+inline long long part2(const Grid& grid)
+{
+    AOC_TRACE_SCOPE("day04::part2");
+    return peel(grid).removed;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = Grid;
+
+    static constexpr int day = 4;
+    static constexpr std::string_view input_path = "puzzles/day04/long.txt";
+
+    static Parsed parse(std::string_view content) { return Grid{content}; }
+    static long long part1(const Parsed& input) { return day04::part1(input); }
+    static long long part2(const Parsed& input) { return day04::part2(input); }
+};
+
+}  // namespace aoc::day04
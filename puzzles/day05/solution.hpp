@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day05
+{
+
+struct RawInput
+{
+    std::vector<std::pair<long long, long long>> ranges;
+    std::vector<long long> ids;
+};
+
+struct Input
+{
+    std::vector<std::pair<long long, long long>> merged_ranges;
+    std::vector<long long> ids;
+};
+
+// Parses a "start-end" line.
+inline std::pair<long long, long long> parse_range(std::string_view line)
+{
+    long long start = 0, end = 0;
+    int idx = 0;
+    for (auto part_rng : split(line, '-'))
+    {
+        auto part = to_string_view(part_rng);
+        if (idx == 0)
+        {
+            start = to_int<long long>(part);
+        }
+        else
+        {
+            end = to_int<long long>(part);
+        }
+        ++idx;
+    }
+    return {start, end};
+}
+
+inline RawInput parse_input(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day05::parse_input");
+    // The range section ends at the first blank line (which may be the very
+    // first line, or a lone '\r' in CRLF input); ids follow it
+    std::string_view ranges_section = content;
+    std::string_view ids_section;
+    for (size_t pos = 0; pos < content.size();)
+    {
+        const size_t eol = std::min(content.find('\n', pos), content.size());
+        const auto line = content.substr(pos, eol - pos);
+        if (line.empty() || line == "\r")
+        {
+            ranges_section = content.substr(0, pos);
+            ids_section = content.substr(std::min(eol + 1, content.size()));
+            break;
+        }
+        pos = eol + 1;
+    }
+
+    const auto [starts, ends] = parse_int_columns<long long, 2>(ranges_section, "-\r\n");
+    auto [ids] = parse_int_columns<long long, 1>(ids_section, "\r\n");
+
+    std::vector<std::pair<long long, long long>> ranges;
+    ranges.reserve(starts.size());
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        ranges.emplace_back(starts[i], ends[i]);
+    }
+
+    return {std::move(ranges), std::move(ids)};
+}
+
+inline std::vector<std::pair<long long, long long>> merge_ranges(std::vector<std::pair<long long, long long>> ranges)
+{
+    AOC_TRACE_SCOPE("day05::merge_ranges");
+    std::sort(ranges.begin(), ranges.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<std::pair<long long, long long>> merged;
+    merged.reserve(ranges.size());
+
+    for (const auto& range : ranges)
+    {
+        if (merged.empty() || merged.back().second < range.first - 1)
+        {
+            merged.push_back(range);
+        }
+        else
+        {
+            merged.back().second = std::max(merged.back().second, range.second);
+        }
+    }
+
+    AOC_TRACE_COUNTER("day05::merged_ranges", merged.size());
+    return merged;
+}
+
+inline Input preprocess_input(RawInput raw)
+{
+    return {merge_ranges(std::move(raw.ranges)), std::move(raw.ids)};
+}
+
+inline bool is_fresh(const std::vector<std::pair<long long, long long>>& merged_ranges, long long id)
+{
+    for (const auto& [start, end] : merged_ranges)
+    {
+        if (id >= start && id <= end)
+        {
+            return true;
+        }
+        if (id < start)
+        {
+            break;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Membership index over merged ranges, answering is_fresh in O(log ranges).
+ *
+ * Merged ranges are disjoint and sorted, so their ends are sorted too and an
+ * id is fresh iff the first range ending at or after it also starts at or
+ * before it. Ends are stored in Eytzinger (BFS) order, 1-based: node k has
+ * children 2k and 2k + 1, so the top levels of every search share a few hot
+ * cache lines. The descent is branchless (the comparison picks the child) and
+ * prefetches the block of node k's descendants four levels down, which hides
+ * part of the memory latency once the array outgrows the caches.
+ */
+class RangeIndex
+{
+  public:
+    explicit RangeIndex(const std::vector<std::pair<long long, long long>>& merged_ranges)
+        : size_(merged_ranges.size()), starts_(size_ + 1), ends_(size_ + 1)
+    {
+        // An in-order walk of the implicit tree visits the nodes in sorted order
+        size_t next = 0;
+        const auto fill = [&](const auto& self, size_t k) -> void {
+            if (k > size_)
+            {
+                return;
+            }
+            self(self, 2 * k);
+            starts_[k] = merged_ranges[next].first;
+            ends_[k] = merged_ranges[next].second;
+            ++next;
+            self(self, 2 * k + 1);
+        };
+        fill(fill, 1);
+    }
+
+    bool contains(long long id) const
+    {
+        const long long* ends = ends_.data();
+        size_t k = 1;
+        while (k <= size_)
+        {
+            __builtin_prefetch(ends + k * kPrefetchStride);
+            k = 2 * k + (ends[k] < id ? 1 : 0);
+        }
+        // Undo the right turns taken after the last left one: k is then the
+        // first node whose end is >= id, or 0 if there is none
+        k >>= std::countr_one(k) + 1;
+        return k != 0 && starts_[k] <= id;
+    }
+
+    size_t size() const { return size_; }
+
+  private:
+    // Descendants of node k four levels down start at 16k
+    static constexpr size_t kPrefetchStride = 16;
+
+    size_t size_;
+    std::vector<long long> starts_;  // Eytzinger order; slot 0 unused
+    std::vector<long long> ends_;
+};
+
+// Counts fresh ids by sorting them and walking both sorted lists once:
+// O(ids log ids + ranges), with purely sequential access to the ranges.
+inline long long count_fresh_merge_join(const std::vector<std::pair<long long, long long>>& merged_ranges,
+                                        std::vector<long long> ids)
+{
+    std::sort(ids.begin(), ids.end());
+    long long num_fresh_ids = 0;
+    size_t r = 0;
+    for (long long id : ids)
+    {
+        while (r < merged_ranges.size() && merged_ranges[r].second < id)
+        {
+            ++r;
+        }
+        num_fresh_ids += r < merged_ranges.size() && merged_ranges[r].first <= id ? 1 : 0;
+    }
+    return num_fresh_ids;
+}
+
+enum class Lookup
+{
+    Auto,        // Default: picked from the range count by choose_lookup
+    LinearScan,  // is_fresh per id, O(ids * ranges); kept as the reference
+    Index,       // RangeIndex search per id, O(ranges + ids log ranges)
+    MergeJoin    // count_fresh_merge_join, O(ids log ids + ranges)
+};
+
+/**
+ * @brief Picks the cheapest lookup for the given number of merged ranges.
+ *
+ * A handful of ranges fits in a cache line or two, where the early-exit linear
+ * scan beats any index. Otherwise the index wins while its ends array stays
+ * cache-resident, as each search is then a few hundred cycles at most. Once it
+ * outgrows the cache, every search pays several misses, which costs more than
+ * sorting a copy of the ids for the merge join (measured with 10^6 ranges and
+ * 10^7 ids: 1.5 s of searches against 1.1 s to sort).
+ */
+inline Lookup choose_lookup(size_t num_ranges)
+{
+    constexpr size_t kMaxLinearScanRanges = 16;
+    constexpr size_t kMaxIndexBytes = size_t{4} << 20;
+
+    if (num_ranges <= kMaxLinearScanRanges)
+    {
+        return Lookup::LinearScan;
+    }
+    return num_ranges * sizeof(long long) > kMaxIndexBytes ? Lookup::MergeJoin : Lookup::Index;
+}
+
+inline long long part1(const Input& input, Lookup lookup = Lookup::Auto)
+{
+    AOC_TRACE_SCOPE("day05::part1");
+    if (lookup == Lookup::Auto)
+    {
+        lookup = choose_lookup(input.merged_ranges.size());
+    }
+
+    long long num_fresh_ids = 0;
+    switch (lookup)
+    {
+    case Lookup::MergeJoin:
+        return count_fresh_merge_join(input.merged_ranges, input.ids);
+    case Lookup::Index: {
+        const RangeIndex index(input.merged_ranges);
+        for (const auto& id : input.ids)
+        {
+            num_fresh_ids += index.contains(id) ? 1 : 0;
+        }
+        return num_fresh_ids;
+    }
+    default:
+        for (const auto& id : input.ids)
+        {
+            if (is_fresh(input.merged_ranges, id))
+            {
+                ++num_fresh_ids;
+            }
+        }
+        return num_fresh_ids;
+    }
+}
+
+// Drops the '\r' that a CRLF line keeps once LineReader has cut the '\n'.
+inline std::string_view strip_cr(std::string_view line)
+{
+    return line.ends_with('\r') ? line.substr(0, line.size() - 1) : line;
+}
+
+/**
+ * @brief Streaming entry points for inputs whose id section does not fit in memory.
+ *
+ * parse_ranges consumes the range section up to (and including) the blank
+ * separator line. part1_stream then reads the remaining ids one line at a time
+ * from the same reader, so only the merged ranges (and their RangeIndex) are
+ * ever held in memory. CRLF input is accepted, as it is by parse_input.
+ */
+inline std::vector<std::pair<long long, long long>> parse_ranges(LineReader& reader)
+{
+    AOC_TRACE_SCOPE("day05::parse_ranges");
+    std::vector<std::pair<long long, long long>> ranges;
+    while (auto line = reader.next())
+    {
+        const auto range_line = strip_cr(*line);
+        if (range_line.empty())
+        {
+            break;
+        }
+        ranges.push_back(parse_range(range_line));
+    }
+    return ranges;
+}
+
+inline long long part1_stream(const std::vector<std::pair<long long, long long>>& merged_ranges, LineReader& reader)
+{
+    AOC_TRACE_SCOPE("day05::part1_stream");
+    const RangeIndex index(merged_ranges);
+    long long num_fresh_ids = 0;
+    for (auto line : reader)
+    {
+        const auto id = strip_cr(line);
+        if (!id.empty() && index.contains(to_int<long long>(id)))
+        {
+            ++num_fresh_ids;
+        }
+    }
+    return num_fresh_ids;
+}
+
+inline long long part2(const Input& input)
+{
+    AOC_TRACE_SCOPE("day05::part2");
+    long long total_size = 0;
+    for (const auto& [start, end] : input.merged_ranges)
+    {
+        total_size += (end - start + 1);
+    }
+    return total_size;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = Input;
+
+    static constexpr int day = 5;
+    static constexpr std::string_view input_path = "puzzles/day05/long.txt";
+
+    static Parsed parse(std::string_view content) { return preprocess_input(parse_input(content)); }
+    static long long part1(const Parsed& input) { return day05::part1(input); }
+    static long long part2(const Parsed& input) { return day05::part2(input); }
+};
+
+}  // namespace aoc::day05
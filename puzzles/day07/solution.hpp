@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cassert>
+#include <numeric>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day07
+{
+
+template <typename T>
+concept CharGridLike = requires(T grid, int row, int col) {
+    { grid.rows } -> std::convertible_to<int>;
+    { grid.cols } -> std::convertible_to<int>;
+    { grid.start_row } -> std::convertible_to<int>;
+    { grid.start_col } -> std::convertible_to<int>;
+    { grid(row, col) } -> std::convertible_to<char>;
+};
+
+// Padded char grid: reads one step past any edge hit the '.' sentinel.
+struct Grid : aoc::Grid<char>
+{
+    int start_row = 0;
+    int start_col = 0;
+
+    /**
+     * @brief Constructs grid from text content and locates start position 'S'.
+     *
+     * Copies line-separated content into a contiguous padded grid.
+     * Scans grid to find 'S' character and stores its coordinates.
+     */
+    Grid(std::string_view content) : aoc::Grid<char>(aoc::Grid<char>::from_text(content, '.'))
+    {
+        AOC_TRACE_SCOPE("day07::parse_grid");
+        for (int r = 0; r < rows; ++r)
+        {
+            for (int c = 0; c < cols; ++c)
+            {
+                if ((*this)(r, c) == 'S')
+                {
+                    start_row = r;
+                    start_col = c;
+                    return;
+                }
+            }
+        }
+    }
+};
+
+template <CharGridLike GridT>
+long long part1(const GridT& grid)
+{
+    AOC_TRACE_SCOPE("day07::part1");
+    std::vector<int> active_columns(grid.cols, 0);
+    active_columns[grid.start_col] = 1;
+
+    int hit_count = 0;
+    for (int i = grid.start_row + 1; i < grid.rows; ++i)
+    {
+        std::vector<int> next_active_columns(grid.cols, 0);
+
+        for (int j = 0; j < grid.cols; ++j)
+        {
+            if (active_columns[j] == 1)
+            {
+                if (grid(i, j) == '^')
+                {
+                    ++hit_count;
+                    if (j - 1 >= 0)
+                    {
+                        next_active_columns[j - 1] = 1;
+                    }
+                    if (j + 1 < grid.cols)
+                    {
+                        next_active_columns[j + 1] = 1;
+                    }
+                }
+                else if (grid(i, j) == '.')
+                {
+                    next_active_columns[j] = 1;
+                }
+            }
+        }
+
+        active_columns = std::move(next_active_columns);
+    }
+
+    return hit_count;
+}
+
+template <CharGridLike GridT>
+long long part2(const GridT& grid)
+{
+    AOC_TRACE_SCOPE("day07::part2");
+    std::vector<long long> counts(grid.cols, 0);
+    counts[grid.start_col] = 1;
+
+    for (int i = grid.start_row + 1; i < grid.rows; ++i)
+    {
+        std::vector<long long> next_counts(grid.cols, 0);
+
+        for (int j = 0; j < grid.cols; ++j)
+        {
+            if (counts[j] == 0)
+            {
+                continue;
+            }
+
+            if (grid(i, j) == '^')
+            {
+                if (j - 1 >= 0)
+                {
+                    next_counts[j - 1] += counts[j];
+                }
+                if (j + 1 < grid.cols)
+                {
+                    next_counts[j + 1] += counts[j];
+                }
+            }
+            else
+            {
+                next_counts[j] += counts[j];
+            }
+        }
+
+        counts = std::move(next_counts);
+    }
+
+    return std::accumulate(counts.begin(), counts.end(), 0LL);
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = Grid;
+
+    static constexpr int day = 7;
+    static constexpr std::string_view input_path = "puzzles/day07/long.txt";
+
+    static Parsed parse(std::string_view content) { return Grid{content}; }
+    static long long part1(const Parsed& input) { return day07::part1(input); }
+    static long long part2(const Parsed& input) { return day07::part2(input); }
+};
+
+}  // namespace aoc::day07
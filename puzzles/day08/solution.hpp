@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day08
+{
+
+template <typename T>
+concept EdgeType = requires(T edge) {
+    { edge.distance } -> std::convertible_to<long long>;
+    requires requires(T a, T b) { a <=> b; };
+};
+
+struct Vertex
+{
+    int x, y, z, id;
+};
+
+struct Edge
+{
+    Vertex v1, v2;
+    long long distance;
+
+    // C++20 three-way comparison - enables automatic sorting by distance
+    auto operator<=>(const Edge& other) const { return distance <=> other.distance; }
+};
+
+class UnionFind
+{
+  public:
+    UnionFind(int n) : parent(n), size(n, 1), num_components(n)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            parent[i] = i;
+        }
+    }
+
+    int find(int x)
+    {
+        if (parent[x] != x)
+        {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    }
+
+    bool unite(int x, int y)
+    {
+        int root_x = find(x);
+        int root_y = find(y);
+        if (root_x == root_y)
+        {
+            return false;
+        }
+        if (size[root_x] < size[root_y])
+        {
+            parent[root_x] = root_y;
+            size[root_y] += size[root_x];
+            size[root_x] = 0;
+        }
+        else
+        {
+            parent[root_y] = root_x;
+            size[root_x] += size[root_y];
+            size[root_y] = 0;
+        }
+        --num_components;
+        return true;
+    }
+
+    std::vector<int> get_top_connected_component_sizes(int num_components)
+    {
+        assert(num_components <= this->num_components && "Requesting more components than exist");
+        std::vector<int> size_copy = size;
+        std::sort(size_copy.begin(), size_copy.end());
+        std::vector<int> result;
+
+        for (int i = 0; i < num_components; ++i)
+        {
+            result.push_back(size_copy[size_copy.size() - 1 - i]);
+        }
+        return result;
+    }
+
+  private:
+    std::vector<int> parent;
+    std::vector<int> size;
+    int num_components;
+};
+
+// Graph with all edges pre-computed and sorted by distance (for Kruskal's algorithm)
+template <EdgeType EdgeT = Edge>
+struct Graph
+{
+    std::vector<Vertex> vertices;
+    std::vector<EdgeT> edges;
+};
+
+inline Graph<Edge> parse_and_build_graph(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day08::parse_and_build_graph");
+    const auto [xs, ys, zs] = parse_int_columns<int, 3>(content, ",\n");
+
+    std::vector<Vertex> vertices;
+    vertices.reserve(xs.size());
+    for (size_t i = 0; i < xs.size(); ++i)
+    {
+        vertices.push_back(Vertex{xs[i], ys[i], zs[i], static_cast<int>(i)});
+    }
+
+    std::vector<Edge> edges;
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        for (size_t j = 0; j < i; ++j)
+        {
+            const auto& v1 = vertices[i];
+            const auto& v2 = vertices[j];
+
+            long long dist = static_cast<long long>(v1.x - v2.x) * (v1.x - v2.x) +
+                             static_cast<long long>(v1.y - v2.y) * (v1.y - v2.y) +
+                             static_cast<long long>(v1.z - v2.z) * (v1.z - v2.z);
+
+            edges.push_back(Edge{v1, v2, dist});
+        }
+    }
+
+    // Sort edges by distance (Kruskal's algorithm)
+    {
+        AOC_TRACE_SCOPE("day08::sort_edges");
+        AOC_TRACE_COUNTER("day08::edges", edges.size());
+        std::sort(edges.begin(), edges.end());
+    }
+
+    return Graph{std::move(vertices), std::move(edges)};
+}
+
+inline long long part1(const Graph<Edge>& graph)
+{
+    AOC_TRACE_SCOPE("day08::part1");
+    UnionFind uf(graph.vertices.size());
+    int num_edges_to_add = 1000;
+    int num_edges_added = 0;
+
+    for (const auto& edge : graph.edges)
+    {
+        uf.unite(edge.v1.id, edge.v2.id);
+        ++num_edges_added;
+        if (num_edges_added >= num_edges_to_add)
+        {
+            break;
+        }
+    }
+
+    auto top_group_sizes = uf.get_top_connected_component_sizes(3);
+    long long res = 1;
+    for (const auto& val : top_group_sizes)
+    {
+        res *= val;
+    }
+    return res;
+}
+
+inline long long part2(const Graph<Edge>& graph)
+{
+    AOC_TRACE_SCOPE("day08::part2");
+    UnionFind uf(graph.vertices.size());
+    int num_components = graph.vertices.size();
+    long long res = 0;
+
+    for (const auto& edge : graph.edges)
+    {
+        if (uf.unite(edge.v1.id, edge.v2.id))
+        {
+            --num_components;
+        }
+        if (num_components == 1)
+        {
+            res = static_cast<long long>(edge.v1.x) * edge.v2.x;
+            break;
+        }
+    }
+    return res;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = Graph<Edge>;
+
+    static constexpr int day = 8;
+    static constexpr std::string_view input_path = "puzzles/day08/long.txt";
+
+    static Parsed parse(std::string_view content) { return parse_and_build_graph(content); }
+    static long long part1(const Parsed& input) { return day08::part1(input); }
+    static long long part2(const Parsed& input) { return day08::part2(input); }
+};
+
+}  // namespace aoc::day08
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day09
+{
+
+using Vertex = std::pair<long, long>;  // (row, col)
+
+inline std::vector<Vertex> parse_input(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day09::parse_input");
+    const auto [cols, rows] = parse_int_columns<long, 2>(content, ",\n");
+
+    std::vector<Vertex> vertices;
+    vertices.reserve(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        // Store as (row, col) but input is col,row
+        vertices.push_back({rows[i], cols[i]});
+    }
+
+    return vertices;
+}
+
+inline long long part1(const std::vector<Vertex>& positions)
+{
+    AOC_TRACE_SCOPE("day09::part1");
+    long long max_area = 0;
+    for (size_t i = 0; i < positions.size() - 1; ++i)
+    {
+        for (size_t j = 0; j < positions.size() - 1; ++j)
+        {
+            if (i == j)
+            {
+                continue;
+            }
+            auto [r1, c1] = positions[i];
+            auto [r2, c2] = positions[j];
+            long long area = std::abs(r1 - r2 + 1) * std::abs(c1 - c2 + 1);
+            max_area = std::max(max_area, area);
+        }
+    }
+    return max_area;
+}
+
+inline std::vector<long> get_coords(const std::vector<long>& raw)
+{
+    std::set<long> coord_set(raw.begin(), raw.end());
+    std::vector<long> coords(coord_set.begin(), coord_set.end());
+    if (!coords.empty())
+    {
+        coords.insert(coords.begin(), coords.front() - 1);
+        coords.push_back(coords.back() + 1);
+    }
+    return coords;
+}
+
+inline int get_idx(long coord, const std::vector<long>& coords)
+{
+    auto it = std::lower_bound(coords.begin(), coords.end(), coord);
+    return 2 * std::distance(coords.begin(), it);
+}
+
+inline long long part2(const std::vector<Vertex>& vertices)
+{
+    AOC_TRACE_SCOPE("day09::part2");
+    std::vector<long> all_rows, all_cols;
+    for (const auto& [r, c] : vertices)
+    {
+        all_rows.push_back(r);
+        all_cols.push_back(c);
+    }
+
+    auto row_coords = get_coords(all_rows);
+    auto col_coords = get_coords(all_cols);
+
+    int height = 2 * row_coords.size();
+    int width = 2 * col_coords.size();
+
+    // 0 = unvisited, 1 = edge, 2 = outside. The border is edge-valued, so the
+    // flood fill below stops at it without bounds checks.
+    constexpr uint8_t kEdge = 1;
+    constexpr uint8_t kOutside = 2;
+    aoc::Grid<uint8_t> grid(height, width, 0, kEdge);
+
+    int num_vertices = vertices.size();
+    for (int i = 0; i < num_vertices; ++i)
+    {
+        auto [r1, c1] = vertices[i];
+        auto [r2, c2] = vertices[(i + 1) % num_vertices];
+
+        int r1_idx = get_idx(r1, row_coords);
+        int c1_idx = get_idx(c1, col_coords);
+        int r2_idx = get_idx(r2, row_coords);
+        int c2_idx = get_idx(c2, col_coords);
+
+        if (r1_idx == r2_idx)
+        {
+            int c_start = std::min(c1_idx, c2_idx);
+            int c_end = std::max(c1_idx, c2_idx);
+            for (int k = c_start; k <= c_end; ++k)
+            {
+                grid(r1_idx, k) = kEdge;
+            }
+        }
+        else
+        {
+            int r_start = std::min(r1_idx, r2_idx);
+            int r_end = std::max(r1_idx, r2_idx);
+            for (int k = r_start; k <= r_end; ++k)
+            {
+                grid(k, c1_idx) = kEdge;
+            }
+        }
+    }
+
+    const auto offsets = grid.neighbor_offsets(kOrthogonalNeighbors);
+    std::vector<size_t> q;
+    q.push_back(grid.index(0, 0));
+    grid(0, 0) = kOutside;
+
+    for (size_t head = 0; head < q.size(); ++head)
+    {
+        for (std::ptrdiff_t offset : offsets)
+        {
+            const size_t next = q[head] + offset;
+            if (grid.cells[next] == 0)
+            {
+                grid.cells[next] = kOutside;
+                q.push_back(next);
+            }
+        }
+    }
+
+    // pref(i, j): outside cells in rows 0..i and columns 0..j; the zero border
+    // stands in for the empty prefixes at row and column -1.
+    aoc::Grid<int> pref(height, width);
+    for (int i = 0; i < height; ++i)
+    {
+        for (int j = 0; j < width; ++j)
+        {
+            int is_invalid = (grid(i, j) == kOutside ? 1 : 0);
+            pref(i, j) = is_invalid + pref(i - 1, j) + pref(i, j - 1) - pref(i - 1, j - 1);
+        }
+    }
+
+    auto get_prefix_sum = [&](int r1, int c1, int r2, int c2) {
+        return pref(r2, c2) - pref(r1 - 1, c2) - pref(r2, c1 - 1) + pref(r1 - 1, c1 - 1);
+    };
+
+    long long max_area = std::numeric_limits<long long>::min();
+
+    for (int i = 0; i < num_vertices; ++i)
+    {
+        for (int j = i + 1; j < num_vertices; ++j)
+        {
+            auto [r1, c1] = vertices[i];
+            auto [r2, c2] = vertices[j];
+
+            int r1_idx = get_idx(r1, row_coords);
+            int c1_idx = get_idx(c1, col_coords);
+            int r2_idx = get_idx(r2, row_coords);
+            int c2_idx = get_idx(c2, col_coords);
+
+            int r_min = std::min(r1_idx, r2_idx);
+            int r_max = std::max(r1_idx, r2_idx);
+            int c_min = std::min(c1_idx, c2_idx);
+            int c_max = std::max(c1_idx, c2_idx);
+
+            if (get_prefix_sum(r_min, c_min, r_max, c_max) == 0)
+            {
+                long long area = (std::abs(r1 - r2) + 1) * (std::abs(c1 - c2) + 1);
+                max_area = std::max(max_area, area);
+            }
+        }
+    }
+    return max_area;
+}
+
+inline long long part2_naive(const std::vector<Vertex>& vertices)
+{
+    AOC_TRACE_SCOPE("day09::part2_naive");
+    long long max_area = 0;
+    int n = vertices.size();
+
+    for (int i = 0; i < n; ++i)
+    {
+        for (int j = i + 1; j < n; ++j)
+        {
+            long r1 = vertices[i].first;
+            long c1 = vertices[i].second;
+            long r2 = vertices[j].first;
+            long c2 = vertices[j].second;
+
+            long min_r = std::min(r1, r2);
+            long max_r = std::max(r1, r2);
+            long min_c = std::min(c1, c2);
+            long max_c = std::max(c1, c2);
+
+            double mid_r = (min_r + max_r) / 2.0;
+            double mid_c = (min_c + max_c) / 2.0;
+            int intersections = 0;
+
+            for (int k = 0; k < n; ++k)
+            {
+                long vr1 = vertices[k].first;
+                long vc1 = vertices[k].second;
+                long vr2 = vertices[(k + 1) % n].first;
+                long vc2 = vertices[(k + 1) % n].second;
+
+                if ((vr1 > mid_r) != (vr2 > mid_r))
+                {
+                    double intersect_c = vc1 + (double)(mid_r - vr1) * (vc2 - vc1) / (vr2 - vr1);
+                    if (intersect_c > mid_c)
+                    {
+                        intersections++;
+                    }
+                }
+            }
+
+            if (intersections % 2 == 0)
+            {
+                continue;
+            }
+
+            bool edge_intersects = false;
+            for (int k = 0; k < n; ++k)
+            {
+                long vr1 = vertices[k].first;
+                long vc1 = vertices[k].second;
+                long vr2 = vertices[(k + 1) % n].first;
+                long vc2 = vertices[(k + 1) % n].second;
+
+                if (vr1 == vr2)
+                {
+                    long edge_r = vr1;
+                    long edge_c_min = std::min(vc1, vc2);
+                    long edge_c_max = std::max(vc1, vc2);
+
+                    if (edge_r > min_r && edge_r < max_r)
+                    {
+                        if (std::max(edge_c_min, min_c) < std::min(edge_c_max, max_c))
+                        {
+                            edge_intersects = true;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    long edge_c = vc1;
+                    long edge_r_min = std::min(vr1, vr2);
+                    long edge_r_max = std::max(vr1, vr2);
+
+                    if (edge_c > min_c && edge_c < max_c)
+                    {
+                        if (std::max(edge_r_min, min_r) < std::min(edge_r_max, max_r))
+                        {
+                            edge_intersects = true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (!edge_intersects)
+            {
+                long long area = (long long)(max_r - min_r + 1) * (max_c - min_c + 1);
+                max_area = std::max(max_area, area);
+            }
+        }
+    }
+    return max_area;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = std::vector<Vertex>;
+
+    static constexpr int day = 9;
+    static constexpr std::string_view input_path = "puzzles/day09/long.txt";
+
+    static Parsed parse(std::string_view content) { return parse_input(content); }
+    static long long part1(const Parsed& input) { return day09::part1(input); }
+    static long long part2(const Parsed& input) { return day09::part2(input); }
+};
+
+}  // namespace aoc::day09
@@ -0,0 +1,557 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day10
+{
+
+template <typename T>
+concept MatrixElement = std::floating_point<T> || std::integral<T>;
+
+template <typename T>
+concept ButtonStructure = requires(T buttons, std::size_t i) {
+    { buttons.size() } -> std::convertible_to<std::size_t>;
+    { buttons[i] } -> std::ranges::range;
+    { buttons[i][0] } -> std::convertible_to<int>;
+};
+
+template <typename T>
+concept TargetVector = requires(T targets, std::size_t i) {
+    { targets.size() } -> std::convertible_to<std::size_t>;
+    { targets[i] } -> std::convertible_to<int>;
+};
+
+// Button wiring of one machine: buttons[j] lists the counters button j toggles.
+// Built per line in a reusable arena, so parsing a machine does not touch the heap.
+using ButtonList = std::pmr::vector<std::pmr::vector<int>>;
+
+/**
+ * @brief Solves linear systems for button-press optimization.
+ *
+ * Constructs A*x=b where:
+ * - A[i][j] = 1 if button j affects counter i, else 0
+ * - b[i] = targets[i]
+ * - x[j] = times to press button j (non-negative integer)
+ *
+ * Algorithm:
+ * 1. Construct augmented matrix [A|b]
+ * 2. Gaussian elimination to RREF
+ * 3. Identify free variables
+ * 4. Recursive search over free variable values
+ * 5. Return min button presses or nullopt
+ *
+ * Complexity: O((m^2)n + V^k) where m=equations, n=vars, V=max_target,
+ * k=free_vars
+ */
+
+template <MatrixElement T = double>
+class GaussianSolver
+{
+  public:
+    using Matrix = std::vector<std::vector<T>>;
+    using Solution = std::optional<std::vector<long long>>;
+
+    static constexpr T kEpsilon = T{1e-9};
+
+    template <TargetVector Targets, ButtonStructure Buttons>
+    Solution solve(const Targets& targets, const Buttons& buttons);
+
+  private:
+    void reduce_to_rref(Matrix& matrix, std::vector<int>& col_to_pivot_row);
+    Solution find_min_solution(const Matrix& matrix, const std::vector<int>& col_to_pivot_row,
+                               std::span<const int> targets, const ButtonList& buttons) const;
+    void identify_variables(const std::vector<int>& col_to_pivot_row, std::vector<int>& free_vars,
+                            std::vector<int>& basic_vars) const;
+    Solution compute_fixed_solution(const Matrix& matrix, const std::vector<int>& col_to_pivot_row) const;
+};
+
+// Parse buttons from format: "(1,2,3) (4,5) (6)"
+inline ButtonList parse_buttons(std::string_view buttons_str,
+                                std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    AOC_TRACE_SCOPE("day10::parse_buttons");
+    ButtonList buttons(resource);
+    buttons.reserve(std::ranges::count(buttons_str, '('));
+
+    size_t pos = 0;
+    while ((pos = buttons_str.find('(', pos)) != std::string_view::npos)
+    {
+        auto close = buttons_str.find(')', pos);
+        if (close == std::string_view::npos)
+        {
+            break;
+        }
+
+        auto inner = buttons_str.substr(pos + 1, close - pos - 1);
+        auto& button_indices = buttons.emplace_back();
+        button_indices.reserve(std::ranges::count(inner, ',') + 1);
+        for (auto part : split(inner, ','))
+        {
+            button_indices.push_back(to_int<int>(to_string_view(part)));
+        }
+        pos = close + 1;
+    }
+
+    return buttons;
+}
+
+inline void dp(std::span<const int> target_lights, const ButtonList& buttons, size_t index,
+               std::span<int> current_lights, int num_press, int& min_press)
+{
+    if (index == buttons.size())
+    {
+        if (std::ranges::equal(current_lights, target_lights))
+        {
+            min_press = std::min(min_press, num_press);
+        }
+        return;
+    }
+
+    // Press the button
+    for (int btn_index : buttons[index])
+    {
+        current_lights[btn_index] = 1 - current_lights[btn_index];
+    }
+    dp(target_lights, buttons, index + 1, current_lights, num_press + 1, min_press);
+
+    // Undo
+    for (int btn_index : buttons[index])
+    {
+        current_lights[btn_index] = 1 - current_lights[btn_index];
+    }
+
+    // Skip
+    dp(target_lights, buttons, index + 1, current_lights, num_press, min_press);
+}
+
+inline long long part1(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day10::part1");
+    long long total_min_press = 0;
+
+    // Per-line scratch comes from a stack buffer that is rewound after each machine
+    std::array<std::byte, 4096> scratch;
+    Arena arena{scratch};
+
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // Parse format: "[.#.#] (1,2) (3,4) ..."
+        auto first_button_pos = line.find('(');
+        if (first_button_pos == std::string_view::npos)
+        {
+            continue;
+        }
+
+        auto lights_str = line.substr(0, first_button_pos - 1);
+        auto buttons_str = line.substr(first_button_pos);
+
+        // Parse target lights
+        arena.release();
+        std::pmr::vector<int> target_lights(arena.resource());
+        target_lights.reserve(lights_str.size());
+        for (char c : lights_str)
+        {
+            if (c == '.')
+            {
+                target_lights.push_back(0);
+            }
+            else if (c == '#')
+            {
+                target_lights.push_back(1);
+            }
+        }
+
+        auto buttons = parse_buttons(buttons_str, arena.resource());
+
+        int min_press = std::numeric_limits<int>::max();
+        std::pmr::vector<int> current_lights(target_lights.size(), 0, arena.resource());
+        dp(target_lights, buttons, 0, current_lights, 0, min_press);
+
+        total_min_press += min_press;
+    }
+
+    return total_min_press;
+}
+
+template <MatrixElement T>
+void GaussianSolver<T>::identify_variables(const std::vector<int>& col_to_pivot_row, std::vector<int>& free_vars,
+                                           std::vector<int>& basic_vars) const
+{
+    const int num_vars = static_cast<int>(col_to_pivot_row.size());
+    for (int j = 0; j < num_vars; ++j)
+    {
+        if (col_to_pivot_row[j] == -1)
+        {
+            free_vars.push_back(j);
+        }
+        else
+        {
+            basic_vars.push_back(j);
+        }
+    }
+}
+
+template <MatrixElement T>
+auto GaussianSolver<T>::find_min_solution(const Matrix& matrix, const std::vector<int>& col_to_pivot_row,
+                                          std::span<const int> targets, const ButtonList& buttons) const -> Solution
+{
+    std::vector<int> free_vars;
+    std::vector<int> basic_vars;
+    identify_variables(col_to_pivot_row, free_vars, basic_vars);
+
+    if (free_vars.empty())
+    {
+        return compute_fixed_solution(matrix, col_to_pivot_row);
+    }
+
+    long long min_total_presses = std::numeric_limits<long long>::max();
+    Solution best_solution = std::nullopt;
+    std::vector<int> current_free_vals(free_vars.size());
+
+    const auto is_negative_or_non_integer = [&](T val) {
+        if (val < -kEpsilon)
+        {
+            return true;
+        }
+        const long long int_val = std::llround(val);
+        return std::abs(val - static_cast<T>(int_val)) > kEpsilon;
+    };
+
+    // Base case lambda
+    auto base_case = [&]() -> void {
+        std::vector<long long> candidate(free_vars.size() + basic_vars.size(), 0LL);
+        long long current_sum = 0;
+        for (int i = 0; i < static_cast<int>(free_vars.size()); ++i)
+        {
+            candidate[free_vars[i]] = current_free_vals[i];
+            current_sum += current_free_vals[i];
+        }
+
+        bool solution_possible = true;
+        for (int basic_idx : basic_vars)
+        {
+            const int row_idx = col_to_pivot_row[basic_idx];
+            T target_val = matrix[row_idx][free_vars.size() + basic_vars.size()];
+
+            for (int i = 0; i < static_cast<int>(free_vars.size()); ++i)
+            {
+                target_val -= matrix[row_idx][free_vars[i]] * current_free_vals[i];
+            }
+
+            if (is_negative_or_non_integer(target_val))
+            {
+                solution_possible = false;
+                break;
+            }
+            const long long rounded = std::llround(target_val);
+            candidate[basic_idx] = rounded;
+            current_sum += rounded;
+        }
+
+        if (solution_possible && current_sum < min_total_presses)
+        {
+            min_total_presses = current_sum;
+            best_solution = candidate;
+        }
+    };
+
+    // Recursive lambda for backtracking
+    auto recursive_search = [&](this auto&& self, int free_idx) -> void {
+        const int num_eqs = static_cast<int>(targets.size());
+        if (free_idx == static_cast<int>(free_vars.size()))
+        {
+            base_case();
+            return;
+        }
+
+        const int free_var_idx = free_vars[free_idx];
+        int limit = *std::max_element(targets.begin(), targets.end()) + 1;
+
+        for (int i = 0; i < num_eqs; ++i)
+        {
+            bool affects = std::ranges::find(buttons[free_var_idx], i) != buttons[free_var_idx].end();
+            if (affects)
+            {
+                limit = std::min(limit, targets[i]);
+            }
+        }
+
+        for (int val = 0; val <= limit; ++val)
+        {
+            current_free_vals[free_idx] = val;
+            bool partial_valid = true;
+
+            for (int basic_idx : basic_vars)
+            {
+                const int row_idx = col_to_pivot_row[basic_idx];
+                T target = matrix[row_idx][free_vars.size() + basic_vars.size()];
+                bool depends_on_unassigned_free_vars = false;
+
+                for (int i = 0; i < static_cast<int>(free_vars.size()); ++i)
+                {
+                    const T coeff = matrix[row_idx][free_vars[i]];
+                    if (i <= free_idx)
+                    {
+                        target -= coeff * current_free_vals[i];
+                    }
+                    else if (std::abs(coeff) > kEpsilon)
+                    {
+                        depends_on_unassigned_free_vars = true;
+                    }
+                }
+
+                if (!depends_on_unassigned_free_vars)
+                {
+                    if (is_negative_or_non_integer(target))
+                    {
+                        partial_valid = false;
+                        break;
+                    }
+                }
+                else if (target < -kEpsilon)
+                {
+                    bool can_increase = false;
+                    for (int future_free_idx = free_idx + 1; future_free_idx < static_cast<int>(free_vars.size());
+                         ++future_free_idx)
+                    {
+                        if (matrix[row_idx][free_vars[future_free_idx]] < -kEpsilon)
+                        {
+                            can_increase = true;
+                            break;
+                        }
+                    }
+                    if (!can_increase)
+                    {
+                        partial_valid = false;
+                        break;
+                    }
+                }
+            }
+
+            if (partial_valid)
+            {
+                self(free_idx + 1);
+            }
+        }
+    };
+
+    recursive_search(0);
+
+    return best_solution;
+}
+
+template <MatrixElement T>
+template <TargetVector Targets, ButtonStructure Buttons>
+auto GaussianSolver<T>::solve(const Targets& targets, const Buttons& buttons) -> Solution
+{
+    const int num_eqs = static_cast<int>(targets.size());
+    const int num_vars = static_cast<int>(buttons.size());
+
+    Matrix matrix(num_eqs, std::vector<T>(num_vars + 1, T{}));
+
+    for (int j = 0; j < num_vars; ++j)
+    {
+        for (int i : buttons[j])
+        {
+            if (i < num_eqs)
+            {
+                matrix[i][j] = T{1};
+            }
+        }
+    }
+
+    for (int i = 0; i < num_eqs; ++i)
+    {
+        matrix[i][num_vars] = static_cast<T>(targets[i]);
+    }
+
+    std::vector<int> col_to_pivot_row(num_vars, -1);
+    reduce_to_rref(matrix, col_to_pivot_row);
+
+    for (const auto& row : matrix)
+    {
+        bool all_zero = true;
+        for (int j = 0; j < num_vars; ++j)
+        {
+            if (std::abs(row[j]) > kEpsilon)
+            {
+                all_zero = false;
+                break;
+            }
+        }
+        if (all_zero && std::abs(row[num_vars]) > kEpsilon)
+        {
+            return std::nullopt;
+        }
+    }
+
+    return find_min_solution(matrix, col_to_pivot_row, targets, buttons);
+}
+
+template <MatrixElement T>
+void GaussianSolver<T>::reduce_to_rref(Matrix& matrix, std::vector<int>& col_to_pivot_row)
+{
+    AOC_TRACE_SCOPE("day10::reduce_to_rref");
+    const int num_eqs = static_cast<int>(matrix.size());
+    const int num_vars = static_cast<int>(col_to_pivot_row.size());
+
+    int pivot_row = 0;
+
+    for (int col_idx = 0; col_idx < num_vars && pivot_row < num_eqs; ++col_idx)
+    {
+        int sel = -1;
+        for (int row_idx = pivot_row; row_idx < num_eqs; ++row_idx)
+        {
+            if (std::abs(matrix[row_idx][col_idx]) > kEpsilon)
+            {
+                sel = row_idx;
+                break;
+            }
+        }
+
+        if (sel == -1)
+        {
+            continue;
+        }
+
+        std::swap(matrix[pivot_row], matrix[sel]);
+
+        const T pivot_val = matrix[pivot_row][col_idx];
+        for (int j = col_idx; j <= num_vars; ++j)
+        {
+            matrix[pivot_row][j] /= pivot_val;
+        }
+
+        for (int row_idx = 0; row_idx < num_eqs; ++row_idx)
+        {
+            if (row_idx == pivot_row)
+            {
+                continue;
+            }
+            const T factor = matrix[row_idx][col_idx];
+            if (std::abs(factor) > kEpsilon)
+            {
+                for (int j = col_idx; j <= num_vars; ++j)
+                {
+                    matrix[row_idx][j] -= factor * matrix[pivot_row][j];
+                }
+            }
+        }
+
+        col_to_pivot_row[col_idx] = pivot_row;
+        ++pivot_row;
+    }
+}
+
+template <MatrixElement T>
+auto GaussianSolver<T>::compute_fixed_solution(const Matrix& matrix,
+                                               const std::vector<int>& col_to_pivot_row) const -> Solution
+{
+    const int num_vars = static_cast<int>(col_to_pivot_row.size());
+    std::vector<long long> solution(num_vars, 0LL);
+    long long current_presses = 0;
+    for (int j = 0; j < num_vars; ++j)
+    {
+        const int row = col_to_pivot_row[j];
+        const T val = matrix[row][num_vars];
+        if (val < -kEpsilon || std::abs(val - static_cast<T>(std::llround(val))) > kEpsilon)
+        {
+            return std::nullopt;
+        }
+        const long long rounded = std::llround(val);
+        solution[j] = rounded;
+        current_presses += rounded;
+    }
+    if (current_presses < std::numeric_limits<long long>::max())
+    {
+        return solution;
+    }
+    return std::nullopt;
+}
+
+inline long long part2(std::string_view content)
+{
+    AOC_TRACE_SCOPE("day10::part2");
+    GaussianSolver<double> solver;
+    std::vector<long long> line_totals;
+
+    std::array<std::byte, 4096> scratch;
+    Arena arena{scratch};
+
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // Parse format: "(1,2) (3,4) ... {5,6,7}"
+        auto first_button_pos = line.find('(');
+        auto first_joltage_pos = line.find('{');
+
+        if (first_button_pos == std::string_view::npos || first_joltage_pos == std::string_view::npos)
+        {
+            continue;
+        }
+
+        auto buttons_str = line.substr(first_button_pos, first_joltage_pos - first_button_pos - 1);
+        auto joltage_str = line.substr(first_joltage_pos + 1);
+
+        // Remove braces from joltage string
+        joltage_str = joltage_str.substr(0, joltage_str.size() - 1);
+
+        // Parse target joltages
+        arena.release();
+        std::pmr::vector<int> target_joltages(arena.resource());
+        target_joltages.reserve(std::ranges::count(joltage_str, ',') + 1);
+        for (auto part : split(joltage_str, ','))
+        {
+            target_joltages.push_back(to_int<int>(to_string_view(part)));
+        }
+
+        auto buttons = parse_buttons(buttons_str, arena.resource());
+
+        if (auto solution = solver.solve(target_joltages, buttons))
+        {
+            line_totals.push_back(std::accumulate(solution->begin(), solution->end(), 0LL));
+        }
+    }
+
+    return std::accumulate(line_totals.begin(), line_totals.end(), 0LL);
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = std::string_view;
+
+    static constexpr int day = 10;
+    static constexpr std::string_view input_path = "puzzles/day10/long.txt";
+
+    static Parsed parse(std::string_view content) { return content; }
+    static long long part1(const Parsed& input) { return day10::part1(input); }
+    static long long part2(const Parsed& input) { return day10::part2(input); }
+};
+
+}  // namespace aoc::day10
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::day11
+{
+
+template <typename T>
+concept GraphNode = std::equality_comparable<T> && requires(T a) {
+    { std::hash<T>{}(a) } -> std::convertible_to<size_t>;
+};
+
+// Node names are views into the input buffer, which must outlive the graph.
+// Containers are pmr so the whole graph can be built in one Arena.
+template <GraphNode NodeType = std::string_view>
+struct Graph
+{
+    using NodeId = int;
+
+    std::pmr::vector<std::pmr::vector<NodeId>> adj_list;
+    std::pmr::unordered_map<NodeType, NodeId> node_to_idx;
+    int num_nodes;
+};
+
+inline Graph<std::string_view> parse_graph(std::string_view content,
+                                           std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+{
+    AOC_TRACE_SCOPE("day11::parse_graph");
+    Graph<std::string_view> graph{
+        std::pmr::vector<std::pmr::vector<int>>(resource), std::pmr::unordered_map<std::string_view, int>(resource), 0};
+
+    // Nearly every node has its own line, so size from the line count: buckets
+    // and vectors dropped by a rehash or regrowth stay stranded in an arena
+    size_t num_lines = 1;
+    for_each_char(content, '\n', [&](size_t) { ++num_lines; });
+    graph.node_to_idx.reserve(2 * num_lines);
+    graph.adj_list.reserve(2 * num_lines);
+
+    const auto intern = [&](std::string_view name) {
+        auto [it, inserted] = graph.node_to_idx.try_emplace(name, graph.num_nodes);
+        if (inserted)
+        {
+            ++graph.num_nodes;
+            graph.adj_list.emplace_back();
+        }
+        return it->second;
+    };
+
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty())
+        {
+            continue;
+        }
+
+        // Parse format: "node: neighbor1 neighbor2 ..."
+        auto colon_pos = line.find(':');
+        if (colon_pos == std::string_view::npos)
+        {
+            continue;
+        }
+
+        const int node = intern(line.substr(0, colon_pos));
+        auto rest = line.substr(colon_pos + 2);  // Skip ": "
+
+        // Parse neighbors
+        for (auto neighbor_rng : split(rest, ' '))
+        {
+            auto neighbor_name = to_string_view(neighbor_rng);
+            if (neighbor_name.empty())
+            {
+                continue;
+            }
+
+            const int neighbor = intern(neighbor_name);
+            graph.adj_list[node].push_back(neighbor);
+        }
+    }
+
+    // One spare slot, as the memo tables are sized num_nodes + 1
+    graph.adj_list.emplace_back();
+    return graph;
+}
+
+// DFS with memoization to count paths in DAG, with cycle detection
+template <GraphNode NodeType>
+long long dfs(const Graph<NodeType>& graph, std::vector<long long>& memo, typename Graph<NodeType>::NodeId start,
+              typename Graph<NodeType>::NodeId end)
+{
+    if (start == end)
+    {
+        return 1;
+    }
+
+    if (memo[start] != -1)
+    {
+        if (memo[start] == -2)
+        {
+            // Cycle detected, invalid for DAG
+            return 0;
+        }
+        return memo[start];
+    }
+
+    memo[start] = -2;  // Mark as visiting
+    long long total_paths = 0;
+    for (int neighbor : graph.adj_list[start])
+    {
+        total_paths += dfs(graph, memo, neighbor, end);
+    }
+    memo[start] = total_paths;
+    return total_paths;
+}
+
+inline long long part1(const Graph<std::string_view>& graph)
+{
+    AOC_TRACE_SCOPE("day11::part1");
+    std::vector<long long> memo(graph.num_nodes + 1, -1);
+    return dfs(graph, memo, graph.node_to_idx.at("you"), graph.node_to_idx.at("out"));
+}
+
+inline long long part2(const Graph<std::string_view>& graph)
+{
+    AOC_TRACE_SCOPE("day11::part2");
+    const std::vector<std::vector<std::pair<std::string_view, std::string_view>>> test_paths = {
+        // Option 1
+        {{"svr", "fft"}, {"fft", "dac"}, {"dac", "out"}},
+        // Option 2
+        {{"svr", "dac"}, {"dac", "fft"}, {"fft", "out"}}};
+
+    long long total_paths = 0;
+
+    for (const auto& test_path : test_paths)
+    {
+        long long path_for_this_option = 1;
+        std::vector<long long> memo(graph.num_nodes + 1, -1);
+
+        for (const auto& [start_name, end_name] : test_path)
+        {
+            int start_idx = graph.node_to_idx.at(start_name);
+            int end_idx = graph.node_to_idx.at(end_name);
+
+            path_for_this_option *= dfs(graph, memo, start_idx, end_idx);
+            memo.assign(graph.num_nodes + 1, -1);
+        }
+
+        total_paths += path_for_this_option;
+    }
+
+    return total_paths;
+}
+
+// Uniform entry points used by the benchmark harness.
+struct Solution
+{
+    using Parsed = ArenaBacked<Graph<std::string_view>>;
+
+    static constexpr int day = 11;
+    static constexpr std::string_view input_path = "puzzles/day11/long.txt";
+
+    static Parsed parse(std::string_view content)
+    {
+        return Parsed([&](auto* resource) { return parse_graph(content, resource); });
+    }
+    static long long part1(const Parsed& input) { return day11::part1(input.value); }
+    static long long part2(const Parsed& input) { return day11::part2(input.value); }
+};
+
+}  // namespace aoc::day11
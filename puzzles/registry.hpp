@@ -0,0 +1,50 @@
+#pragma once
+
+#include <concepts>
+#include <string_view>
+#include <tuple>
+
+#include "puzzles/day01/solution.hpp"
+#include "puzzles/day02/solution.hpp"
+#include "puzzles/day03/solution.hpp"
+#include "puzzles/day04/solution.hpp"
+#include "puzzles/day05/solution.hpp"
+#include "puzzles/day06/solution.hpp"
+#include "puzzles/day07/solution.hpp"
+#include "puzzles/day08/solution.hpp"
+#include "puzzles/day09/solution.hpp"
+#include "puzzles/day10/solution.hpp"
+#include "puzzles/day11/solution.hpp"
+#include "puzzles/day12/solution.hpp"
+
+namespace aoc
+{
+
+// Every day exposes a Solution with a parse phase and one or two parts.
+template <typename S>
+concept DaySolution = requires(std::string_view content, const typename S::Parsed& parsed) {
+    { S::day } -> std::convertible_to<int>;
+    { S::input_path } -> std::convertible_to<std::string_view>;
+    { S::parse(content) } -> std::same_as<typename S::Parsed>;
+    { S::part1(parsed) } -> std::convertible_to<long long>;
+};
+
+// Day 12 only has a single part.
+template <typename S>
+concept HasPart2 = DaySolution<S> && requires(const typename S::Parsed& parsed) {
+    { S::part2(parsed) } -> std::convertible_to<long long>;
+};
+
+using AllDays = std::tuple<day01::Solution, day02::Solution, day03::Solution, day04::Solution, day05::Solution,
+                           day06::Solution, day07::Solution, day08::Solution, day09::Solution, day10::Solution,
+                           day11::Solution, day12::Solution>;
+
+// Calls f(S{}) for every day's Solution type, in day order.
+// Usage: for_each_day([]<DaySolution S>(S) { ... S::parse(content) ... });
+template <typename F>
+void for_each_day(F&& f)
+{
+    std::apply([&](auto... days) { (f(days), ...); }, AllDays{});
+}
+
+}  // namespace aoc
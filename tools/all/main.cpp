@@ -0,0 +1,271 @@
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "puzzles/registry.hpp"
+
+namespace aoc::runner
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Config
+{
+    size_t threads = ThreadPool::default_concurrency();
+    std::set<int> days;                           // Empty means every day
+    std::map<int, std::filesystem::path> inputs;  // Per-day overrides from --input DAY=PATH
+    std::filesystem::path input_dir = ".";
+};
+
+struct DayResult
+{
+    int day = 0;
+    std::optional<long long> part1;
+    std::optional<long long> part2;
+    double parse_ms = 0;
+    double part1_ms = 0;
+    double part2_ms = 0;
+    std::string error;
+};
+
+/**
+ * @brief Maps each distinct input file exactly once.
+ *
+ * Days that read the same file (e.g. several --input overrides pointing at one
+ * generated input) share the mapping. The first caller maps the file while
+ * later callers for the same path wait on its shared_future, so the file is
+ * never mapped twice even when days start concurrently.
+ */
+class InputCache
+{
+  public:
+    using Handle = std::shared_ptr<const MappedFile>;
+
+    Handle get(const std::filesystem::path& path)
+    {
+        const auto key = std::filesystem::weakly_canonical(path);
+        std::promise<Handle> promise;
+        std::shared_future<Handle> future;
+        bool owner = false;
+        {
+            std::lock_guard lock(mutex_);
+            auto [it, inserted] = files_.try_emplace(key);
+            if (inserted)
+            {
+                it->second = promise.get_future().share();
+                owner = true;
+            }
+            future = it->second;
+        }
+
+        if (owner)
+        {
+            try
+            {
+                promise.set_value(std::make_shared<const MappedFile>(path));
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+            }
+        }
+        return future.get();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::map<std::filesystem::path, std::shared_future<Handle>> files_;
+};
+
+double elapsed_ms(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void print_usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0 << " [options]\n"
+              << "  --day N           Only run day N (repeatable)\n"
+              << "  --input N=PATH    Read day N's input from PATH (repeatable)\n"
+              << "  --input-dir DIR   Directory containing puzzles/dayXX/long.txt (default .)\n"
+              << "  --threads N       Worker threads (default: hardware concurrency)\n";
+}
+
+Config parse_args(int argc, char** argv)
+{
+    Config config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            throw std::runtime_error("Missing value for " + std::string(arg));
+        }
+        std::string_view value = argv[++i];
+
+        if (arg == "--day")
+        {
+            config.days.insert(to_int<int>(value));
+        }
+        else if (arg == "--input")
+        {
+            auto eq = value.find('=');
+            if (eq == std::string_view::npos)
+            {
+                throw std::runtime_error("--input expects DAY=PATH");
+            }
+            config.inputs[to_int<int>(value.substr(0, eq))] = value.substr(eq + 1);
+        }
+        else if (arg == "--input-dir")
+        {
+            config.input_dir = value;
+        }
+        else if (arg == "--threads")
+        {
+            config.threads = std::max<size_t>(1, to_int<size_t>(value));
+        }
+        else
+        {
+            throw std::runtime_error("Unknown argument: " + std::string(arg));
+        }
+    }
+    return config;
+}
+
+/**
+ * @brief Schedules one day on the pool.
+ *
+ * The parse task runs first; once it finishes it submits part1 and part2 as
+ * independent tasks sharing the parsed input, so both parts of a day run in
+ * parallel with each other and with every other day.
+ */
+template <DaySolution S>
+void schedule_day(ThreadPool& pool, InputCache& cache, const Config& config, DayResult& result,
+                  std::mutex& error_mutex)
+{
+    result.day = S::day;
+    const auto path = config.inputs.contains(S::day) ? config.inputs.at(S::day) : config.input_dir / S::input_path;
+
+    const auto record_error = [&result, &error_mutex](const std::exception& e) {
+        std::lock_guard lock(error_mutex);
+        result.error += result.error.empty() ? e.what() : std::string("; ") + e.what();
+    };
+
+    pool.submit([&pool, &cache, &result, record_error, path] {
+        try
+        {
+            auto content = cache.get(path);
+            auto start = Clock::now();
+            auto parsed = std::make_shared<const typename S::Parsed>(S::parse(*content));
+            result.parse_ms = elapsed_ms(start);
+
+            // content is captured too: some days parse into views of the input
+            pool.submit([&result, record_error, content, parsed] {
+                try
+                {
+                    auto start = Clock::now();
+                    result.part1 = S::part1(*parsed);
+                    result.part1_ms = elapsed_ms(start);
+                }
+                catch (const std::exception& e)
+                {
+                    record_error(e);
+                }
+            });
+
+            if constexpr (HasPart2<S>)
+            {
+                pool.submit([&result, record_error, content, parsed] {
+                    try
+                    {
+                        auto start = Clock::now();
+                        result.part2 = S::part2(*parsed);
+                        result.part2_ms = elapsed_ms(start);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        record_error(e);
+                    }
+                });
+            }
+        }
+        catch (const std::exception& e)
+        {
+            record_error(e);
+        }
+    });
+}
+
+std::string format_answer(const std::optional<long long>& answer)
+{
+    return answer ? std::to_string(*answer) : "-";
+}
+
+}  // namespace aoc::runner
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        using namespace aoc;
+        using namespace aoc::runner;
+
+        const auto config = parse_args(argc, argv);
+        const auto wall_start = Clock::now();
+
+        // Results are preallocated so tasks can write to their slot without locking
+        std::vector<DayResult> results(std::tuple_size_v<AllDays>);
+        std::mutex error_mutex;
+        InputCache cache;
+        {
+            ThreadPool pool(config.threads);
+            size_t slot = 0;
+            for_each_day([&]<DaySolution S>(S) {
+                auto& result = results[slot++];
+                if (config.days.empty() || config.days.contains(S::day))
+                {
+                    schedule_day<S>(pool, cache, config, result, error_mutex);
+                }
+            });
+            pool.wait_idle();
+        }
+
+        const double wall_ms = elapsed_ms(wall_start);
+        double sum_ms = 0;
+        bool failed = false;
+
+        std::printf("%-4s %20s %20s %10s %10s %10s\n", "day", "part1", "part2", "parse ms", "part1 ms", "part2 ms");
+        for (const auto& r : results)
+        {
+            if (r.day == 0)
+            {
+                continue;
+            }
+            std::printf("%-4d %20s %20s %10.3f %10.3f %10.3f\n", r.day, format_answer(r.part1).c_str(),
+                        format_answer(r.part2).c_str(), r.parse_ms, r.part1_ms, r.part2_ms);
+            if (!r.error.empty())
+            {
+                std::fprintf(stderr, "Day %d failed: %s\n", r.day, r.error.c_str());
+                failed = true;
+            }
+            sum_ms += r.parse_ms + r.part1_ms + r.part2_ms;
+        }
+        std::printf("wall %.3f ms, sum of phases %.3f ms, %zu threads\n", wall_ms, sum_ms, config.threads);
+
+        return failed ? 1 : 0;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        aoc::runner::print_usage(argv[0]);
+        return 1;
+    }
+}
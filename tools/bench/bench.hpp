@@ -0,0 +1,436 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::bench
+{
+
+// Keeps the compiler from discarding a value (and the work that produced it)
+// whose result is otherwise unused in a timing loop.
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Stats
+{
+    double min_ns = 0;
+    double median_ns = 0;
+    double p99_ns = 0;
+    double mean_ns = 0;
+    double max_ns = 0;
+};
+
+/**
+ * @brief Summarizes a set of timing samples.
+ *
+ * Percentiles use the nearest-rank method, so p99 of fewer than 100 samples is
+ * simply the slowest one; median averages the two middle samples.
+ */
+inline Stats summarize(std::vector<double> samples)
+{
+    Stats stats;
+    if (samples.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const size_t n = samples.size();
+    const auto nearest_rank = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(n)));
+        return samples[std::clamp<size_t>(rank, 1, n) - 1];
+    };
+
+    stats.min_ns = samples.front();
+    stats.max_ns = samples.back();
+    stats.median_ns = n % 2 == 1 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2.0;
+    stats.p99_ns = nearest_rank(0.99);
+    stats.mean_ns = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(n);
+    return stats;
+}
+
+// One timed phase (parse, part1 or part2) of one day.
+struct PhaseResult
+{
+    int day;
+    std::string phase;
+    long long answer;  // 0 for the parse phase
+    std::vector<double> samples_ns;
+    Stats stats;
+};
+
+struct Options
+{
+    int warmup = 1;
+    int reps = 10;
+};
+
+/**
+ * @brief Times fn over warmup + reps iterations.
+ *
+ * Warmup runs fault in the input pages and settle caches and branch predictors;
+ * only the timed repetitions are recorded. fn's result is returned from the
+ * last repetition so it can be checked or fed into the next phase.
+ */
+template <typename F>
+auto measure(const Options& options, std::vector<double>& samples_ns, F&& fn)
+{
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < options.warmup; ++i)
+    {
+        do_not_optimize(fn());
+    }
+
+    samples_ns.clear();
+    samples_ns.reserve(options.reps);
+    for (int i = 0; i + 1 < options.reps; ++i)
+    {
+        auto start = Clock::now();
+        auto result = fn();
+        auto stop = Clock::now();
+        do_not_optimize(result);
+        samples_ns.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+
+    auto start = Clock::now();
+    auto result = fn();
+    auto stop = Clock::now();
+    samples_ns.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    return result;
+}
+
+inline std::string format_duration(double ns)
+{
+    char buf[32];
+    if (ns < 1e3)
+    {
+        std::snprintf(buf, sizeof(buf), "%.0f ns", ns);
+    }
+    else if (ns < 1e6)
+    {
+        std::snprintf(buf, sizeof(buf), "%.2f us", ns / 1e3);
+    }
+    else if (ns < 1e9)
+    {
+        std::snprintf(buf, sizeof(buf), "%.2f ms", ns / 1e6);
+    }
+    else
+    {
+        std::snprintf(buf, sizeof(buf), "%.3f s", ns / 1e9);
+    }
+    return buf;
+}
+
+inline std::string to_json(const std::vector<PhaseResult>& results, const Options& options)
+{
+    std::string out = "{\n  \"warmup\": " + std::to_string(options.warmup) +
+                      ",\n  \"reps\": " + std::to_string(options.reps) + ",\n  \"benchmarks\": [";
+    char buf[512];
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        std::snprintf(buf, sizeof(buf),
+                      "%s\n    {\"day\": %d, \"phase\": \"%s\", \"answer\": %lld, \"min_ns\": %.0f, "
+                      "\"median_ns\": %.0f, \"p99_ns\": %.0f, \"mean_ns\": %.0f, \"max_ns\": %.0f}",
+                      i == 0 ? "" : ",", r.day, r.phase.c_str(), r.answer, r.stats.min_ns, r.stats.median_ns,
+                      r.stats.p99_ns, r.stats.mean_ns, r.stats.max_ns);
+        out += buf;
+    }
+    out += "\n  ]\n}\n";
+    return out;
+}
+
+// Baseline of previous runs: the answer and raw timing samples of every
+// (day, phase) in each of several independent runs (separate processes).
+// Stored as plain text, one phase of one run per line:
+//   <day> <phase> <answer> <sample_ns> <sample_ns> ...
+// A (day, phase) appears once per run. Lines starting with '#' are comments.
+struct BaselineEntry
+{
+    long long answer = 0;
+    std::vector<std::vector<double>> runs;  // Samples of each run
+};
+
+using Baseline = std::map<std::pair<int, std::string>, BaselineEntry>;
+
+// Adds the phases of one run, which must agree with the answers already held.
+inline void add_run(Baseline& baseline, const std::vector<PhaseResult>& results)
+{
+    for (const auto& r : results)
+    {
+        auto [it, inserted] = baseline.try_emplace({r.day, r.phase}, BaselineEntry{r.answer, {}});
+        if (!inserted && it->second.answer != r.answer)
+        {
+            throw std::runtime_error("Day " + std::to_string(r.day) + " " + r.phase + " answer differs between runs");
+        }
+        it->second.runs.push_back(r.samples_ns);
+    }
+}
+
+inline std::string format_baseline(const Baseline& baseline)
+{
+    std::string out;
+    for (const auto& [key, entry] : baseline)
+    {
+        for (const auto& samples : entry.runs)
+        {
+            out += std::to_string(key.first) + ' ' + key.second + ' ' + std::to_string(entry.answer);
+            for (double sample : samples)
+            {
+                out += ' ' + std::to_string(static_cast<long long>(sample));
+            }
+            out += '\n';
+        }
+    }
+    return out;
+}
+
+inline void save_baseline(const std::string& path, const Baseline& baseline)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Could not write baseline: " + path);
+    }
+    std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    out << "# aoc_bench baseline, recorded " << date << "\n" << format_baseline(baseline);
+    if (!out)
+    {
+        throw std::runtime_error("Could not write baseline: " + path);
+    }
+}
+
+// Parses baseline lines into baseline, one run per line.
+inline void parse_baseline(std::string_view content, Baseline& baseline)
+{
+    for (auto line_rng : get_lines(content))
+    {
+        auto line = to_string_view(line_rng);
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::vector<std::string_view> fields;
+        for (auto field : split(line, ' '))
+        {
+            fields.push_back(to_string_view(field));
+        }
+        if (fields.size() < 4)
+        {
+            throw std::runtime_error("Malformed baseline line: " + std::string(line));
+        }
+
+        std::vector<double> samples;
+        for (size_t i = 3; i < fields.size(); ++i)
+        {
+            samples.push_back(static_cast<double>(to_int<long long>(fields[i])));
+        }
+        const long long answer = to_int<long long>(fields[2]);
+        auto [it, inserted] =
+            baseline.try_emplace({to_int<int>(fields[0]), std::string(fields[1])}, BaselineEntry{answer, {}});
+        if (!inserted && it->second.answer != answer)
+        {
+            throw std::runtime_error("Conflicting answers in baseline line: " + std::string(line));
+        }
+        it->second.runs.push_back(std::move(samples));
+    }
+}
+
+inline Baseline load_baseline(const std::string& path)
+{
+    const MappedFile content{path};
+    Baseline baseline;
+    parse_baseline(content, baseline);
+    return baseline;
+}
+
+/**
+ * @brief One-sided Mann-Whitney U test that `after` is slower than `before`.
+ *
+ * Rank-based, so it makes no normality assumption and a few outliers (page
+ * faults, a preempted rep) cannot dominate the result the way they would a
+ * t-test on means. Uses the normal approximation with tie and continuity
+ * corrections, which is reasonable from roughly 8 samples per side and
+ * slightly conservative below that (two fully separated sets of 5 give 0.006
+ * against an exact 0.004).
+ * Returns the p-value of observing this much slowdown by chance.
+ */
+inline double mann_whitney_slower_p(const std::vector<double>& before, const std::vector<double>& after)
+{
+    const size_t n1 = before.size();
+    const size_t n2 = after.size();
+    if (n1 == 0 || n2 == 0)
+    {
+        return 1.0;
+    }
+
+    std::vector<std::pair<double, bool>> pooled;  // (sample, is_after)
+    pooled.reserve(n1 + n2);
+    for (double x : before)
+    {
+        pooled.emplace_back(x, false);
+    }
+    for (double x : after)
+    {
+        pooled.emplace_back(x, true);
+    }
+    std::sort(pooled.begin(), pooled.end());
+
+    // Average ranks over ties; accumulate the tie correction term sum(t^3 - t)
+    double rank_sum_after = 0;
+    double tie_term = 0;
+    for (size_t i = 0; i < pooled.size();)
+    {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first)
+        {
+            ++j;
+        }
+        const double avg_rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+        for (size_t k = i; k < j; ++k)
+        {
+            rank_sum_after += pooled[k].second ? avg_rank : 0.0;
+        }
+        const double t = static_cast<double>(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+
+    const double N1 = static_cast<double>(n1);
+    const double N2 = static_cast<double>(n2);
+    const double N = N1 + N2;
+    const double u_after = rank_sum_after - N2 * (N2 + 1) / 2.0;
+    const double mean_u = N1 * N2 / 2.0;
+    const double var_u = N1 * N2 / 12.0 * ((N + 1) - tie_term / (N * (N - 1)));
+    if (var_u <= 0)
+    {
+        return 1.0;
+    }
+    const double z = (u_after - mean_u - 0.5) / std::sqrt(var_u);
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+struct GateOptions
+{
+    double threshold = 0.05;     // Relative median slowdown that counts as a regression
+    double alpha = 0.01;         // Significance level for the Mann-Whitney test
+    double min_delta_ns = 5000;  // Smaller absolute slowdowns are within timer and cache noise
+};
+
+/**
+ * @brief Compares a set of runs against a baseline and prints a report.
+ *
+ * Samples taken in one process are not independent: code layout, heap state
+ * and the machine's load at the time shift a whole run together, often by
+ * tens of percent. So the unit of comparison is a run, not a sample. Each
+ * run is reduced to its median and the two sets of run medians go through the
+ * Mann-Whitney test. A phase fails if its answer changed, or if the median of
+ * its run medians is more than the threshold above the slowest baseline run
+ * (so the baseline's own run-to-run spread counts as noise), AND more than
+ * min_delta_ns above the baseline median, AND the slowdown is significant.
+ * With the default alpha that takes about five runs per side; fewer runs can
+ * never fail on timing.
+ *
+ * Baseline entries with no result fail as MISSING (say, a deleted input),
+ * except for days outside `days` when the run was limited to some days.
+ * Returns true if every phase passed.
+ */
+inline bool compare_to_baseline(const Baseline& current, const Baseline& baseline, const GateOptions& gate,
+                                const std::set<int>& days)
+{
+    const auto run_medians = [](const BaselineEntry& entry) {
+        std::vector<double> medians;
+        for (const auto& samples : entry.runs)
+        {
+            medians.push_back(summarize(samples).median_ns);
+        }
+        return medians;
+    };
+
+    bool ok = true;
+    std::printf("%-5s %-6s %12s %12s %9s %10s  %s\n", "day", "phase", "baseline", "current", "change", "p-value",
+                "verdict");
+    for (const auto& [key, base] : baseline)
+    {
+        const auto& [day, phase] = key;
+        if (!current.contains(key) && (days.empty() || days.contains(day)))
+        {
+            std::printf("%-5d %-6s %12s %12s %9s %10s  MISSING\n", day, phase.c_str(), "-", "-", "-", "-");
+            ok = false;
+        }
+    }
+
+    for (const auto& [key, cur] : current)
+    {
+        const auto& [day, phase] = key;
+        const auto cur_medians = run_medians(cur);
+        const double cur_median = summarize(cur_medians).median_ns;
+
+        auto it = baseline.find(key);
+        if (it == baseline.end())
+        {
+            std::printf("%-5d %-6s %12s %12s %9s %10s  new\n", day, phase.c_str(), "-",
+                        format_duration(cur_median).c_str(), "-", "-");
+            continue;
+        }
+
+        const auto& base = it->second;
+        const auto base_medians = run_medians(base);
+        const double base_median = summarize(base_medians).median_ns;
+        const double delta = cur_median - base_median;
+        const double change = base_median > 0 ? delta / base_median : 0.0;
+        const double p = mann_whitney_slower_p(base_medians, cur_medians);
+        const auto [fastest, slowest] = std::ranges::minmax(base_medians);
+
+        const bool wrong = phase != "parse" && cur.answer != base.answer;
+        const char* verdict = "ok";
+        if (wrong)
+        {
+            verdict = "WRONG ANSWER";
+            ok = false;
+        }
+        else if (cur_median > slowest * (1.0 + gate.threshold) && delta > gate.min_delta_ns && p < gate.alpha)
+        {
+            verdict = "SLOWER";
+            ok = false;
+        }
+        else if (cur_median < fastest * (1.0 - gate.threshold) && -delta > gate.min_delta_ns &&
+                 mann_whitney_slower_p(cur_medians, base_medians) < gate.alpha)
+        {
+            verdict = "faster";
+        }
+
+        std::printf("%-5d %-6s %12s %12s %+8.1f%% %10.2g  %s\n", day, phase.c_str(),
+                    format_duration(base_median).c_str(), format_duration(cur_median).c_str(), change * 100.0, p,
+                    verdict);
+        if (wrong)
+        {
+            std::printf("      expected %lld, got %lld\n", base.answer, cur.answer);
+        }
+    }
+    return ok;
+}
+
+}  // namespace aoc::bench
@@ -0,0 +1,300 @@
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "puzzles/registry.hpp"
+#include "tools/bench/bench.hpp"
+
+namespace aoc::bench
+{
+
+struct Config
+{
+    Options options;
+    std::set<int> days;  // Empty means every day
+    std::filesystem::path input_dir = ".";
+    bool json = false;
+    std::string save_baseline;  // Record these runs as the new baseline
+    std::string compare;        // Gate these runs against a stored baseline
+    int runs = 5;               // Independent processes per baseline or comparison
+    bool emit_run = false;      // Print one run in baseline format (a --runs child)
+    GateOptions gate;
+};
+
+void print_usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0 << " [options]\n"
+              << "  --day N          Only run day N (repeatable)\n"
+              << "  --warmup N       Untimed iterations per phase (default 1)\n"
+              << "  --reps N         Timed iterations per phase (default 10)\n"
+              << "  --input-dir DIR  Directory containing puzzles/dayXX/long.txt (default .)\n"
+              << "  --json           Print results as JSON instead of a table\n"
+              << "  --save-baseline FILE  Record answers and timing samples of --runs runs\n"
+              << "  --compare FILE   Exit non-zero on a wrong answer or a significant slowdown vs FILE\n"
+              << "  --runs N         Separate processes timed for --save-baseline/--compare (default 5)\n"
+              << "  --threshold PCT  Median slowdown that counts as a regression (default 5)\n"
+              << "  --min-delta NS   Smallest absolute slowdown that counts as a regression (default 5000)\n"
+              << "  --alpha P        Significance level of the Mann-Whitney test (default 0.01)\n"
+              << "  --emit-run       Print this run in baseline format (used by --runs)\n";
+}
+
+double parse_double(std::string_view sv)
+{
+    double result = 0;
+    auto [ptr, ec] = std::from_chars(sv.data(), sv.data() + sv.size(), result);
+    if (ec != std::errc() || ptr != sv.data() + sv.size())
+    {
+        throw std::runtime_error("Failed to parse number: " + std::string(sv));
+    }
+    return result;
+}
+
+Config parse_args(int argc, char** argv)
+{
+    Config config;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string_view arg = argv[i];
+        const auto value = [&]() -> std::string_view {
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Missing value for " + std::string(arg));
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--day")
+        {
+            config.days.insert(to_int<int>(value()));
+        }
+        else if (arg == "--warmup")
+        {
+            config.options.warmup = to_int<int>(value());
+        }
+        else if (arg == "--reps")
+        {
+            config.options.reps = to_int<int>(value());
+        }
+        else if (arg == "--input-dir")
+        {
+            config.input_dir = value();
+        }
+        else if (arg == "--json")
+        {
+            config.json = true;
+        }
+        else if (arg == "--save-baseline")
+        {
+            config.save_baseline = value();
+        }
+        else if (arg == "--compare")
+        {
+            config.compare = value();
+        }
+        else if (arg == "--runs")
+        {
+            config.runs = to_int<int>(value());
+        }
+        else if (arg == "--emit-run")
+        {
+            config.emit_run = true;
+        }
+        else if (arg == "--min-delta")
+        {
+            config.gate.min_delta_ns = parse_double(value());
+        }
+        else if (arg == "--threshold")
+        {
+            config.gate.threshold = parse_double(value()) / 100.0;
+        }
+        else if (arg == "--alpha")
+        {
+            config.gate.alpha = parse_double(value());
+        }
+        else
+        {
+            throw std::runtime_error("Unknown argument: " + std::string(arg));
+        }
+    }
+
+    if (config.options.reps < 1 || config.options.warmup < 0 || config.runs < 1)
+    {
+        throw std::runtime_error("--reps and --runs must be at least 1 and --warmup non-negative");
+    }
+    return config;
+}
+
+template <DaySolution S>
+void run_day(const Config& config, std::vector<PhaseResult>& results)
+{
+    const auto path = config.input_dir / S::input_path;
+    if (!std::filesystem::exists(path))
+    {
+        std::cerr << "Skipping day " << S::day << ": " << path.string() << " not found\n";
+        return;
+    }
+
+    // Loading is excluded from the timings; the mapping stays hot across reps.
+    const MappedFile content{path};
+
+    PhaseResult parse{S::day, "parse", 0, {}, {}};
+    const auto parsed = measure(config.options, parse.samples_ns, [&] { return S::parse(content); });
+    parse.stats = summarize(parse.samples_ns);
+    results.push_back(std::move(parse));
+
+    PhaseResult part1{S::day, "part1", 0, {}, {}};
+    part1.answer = measure(config.options, part1.samples_ns, [&] { return S::part1(parsed); });
+    part1.stats = summarize(part1.samples_ns);
+    results.push_back(std::move(part1));
+
+    if constexpr (HasPart2<S>)
+    {
+        PhaseResult part2{S::day, "part2", 0, {}, {}};
+        part2.answer = measure(config.options, part2.samples_ns, [&] { return S::part2(parsed); });
+        part2.stats = summarize(part2.samples_ns);
+        results.push_back(std::move(part2));
+    }
+}
+
+std::vector<PhaseResult> run_all(const Config& config)
+{
+    std::vector<PhaseResult> results;
+    for_each_day([&]<DaySolution S>(S) {
+        if (config.days.empty() || config.days.contains(S::day))
+        {
+            run_day<S>(config, results);
+        }
+    });
+    return results;
+}
+
+std::string shell_quote(std::string_view s)
+{
+    std::string out = "'";
+    for (char c : s)
+    {
+        out += c == '\'' ? std::string("'\\''") : std::string(1, c);
+    }
+    return out + "'";
+}
+
+/**
+ * @brief Times config.runs runs, each in a fresh process.
+ *
+ * Each run re-executes this binary with --emit-run and reads its results back
+ * in baseline format. Separate processes get their own address-space layout,
+ * heap and page-cache state, so run-to-run variation shows up between runs
+ * instead of being baked into every sample of a single one.
+ */
+Baseline collect_runs(const Config& config)
+{
+    std::string command = shell_quote(std::filesystem::read_symlink("/proc/self/exe").string()) + " --emit-run" +
+                          " --warmup " + std::to_string(config.options.warmup) + " --reps " +
+                          std::to_string(config.options.reps) + " --input-dir " +
+                          shell_quote(config.input_dir.string());
+    for (int day : config.days)
+    {
+        command += " --day " + std::to_string(day);
+    }
+
+    Baseline runs;
+    for (int run = 0; run < config.runs; ++run)
+    {
+        std::fprintf(stderr, "Run %d/%d\n", run + 1, config.runs);
+        FILE* pipe = popen(command.c_str(), "r");
+        if (pipe == nullptr)
+        {
+            throw std::runtime_error("Could not start benchmark run: " + command);
+        }
+        std::string output;
+        char buf[4096];
+        size_t n = 0;
+        while ((n = std::fread(buf, 1, sizeof(buf), pipe)) > 0)
+        {
+            output.append(buf, n);
+        }
+        if (pclose(pipe) != 0)
+        {
+            throw std::runtime_error("Benchmark run failed: " + command);
+        }
+
+        parse_baseline(output, runs);
+    }
+    return runs;
+}
+
+void print_table(const std::vector<PhaseResult>& results)
+{
+    std::printf("%-5s %-6s %20s %12s %12s %12s %12s\n", "day", "phase", "answer", "min", "median", "p99", "mean");
+    for (const auto& r : results)
+    {
+        std::printf("%-5d %-6s %20lld %12s %12s %12s %12s\n", r.day, r.phase.c_str(), r.answer,
+                    format_duration(r.stats.min_ns).c_str(), format_duration(r.stats.median_ns).c_str(),
+                    format_duration(r.stats.p99_ns).c_str(), format_duration(r.stats.mean_ns).c_str());
+    }
+}
+
+}  // namespace aoc::bench
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        using namespace aoc;
+        using namespace aoc::bench;
+
+        const auto config = parse_args(argc, argv);
+
+        if (config.emit_run)
+        {
+            Baseline run;
+            add_run(run, run_all(config));
+            std::cout << format_baseline(run);
+            return 0;
+        }
+
+        // Load up front so a bad baseline path fails before the benchmarks run
+        std::optional<Baseline> baseline;
+        if (!config.compare.empty())
+        {
+            baseline = load_baseline(config.compare);
+        }
+
+        if (config.save_baseline.empty() && !baseline)
+        {
+            const auto results = run_all(config);
+            if (config.json)
+            {
+                std::cout << to_json(results, config.options);
+            }
+            else
+            {
+                print_table(results);
+            }
+            return 0;
+        }
+
+        const auto current = collect_runs(config);
+        if (!config.save_baseline.empty())
+        {
+            save_baseline(config.save_baseline, current);
+        }
+        if (baseline && !compare_to_baseline(current, *baseline, config.gate, config.days))
+        {
+            return 2;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        aoc::bench::print_usage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,573 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "puzzles/common.hpp"
+
+namespace aoc::gen
+{
+
+/**
+ * @brief Small deterministic PRNG (SplitMix64).
+ *
+ * std::mt19937 is portable but the std distributions are not, so the same seed
+ * could produce different inputs with libstdc++ and libc++. Bounded draws use
+ * Lemire's multiply-shift reduction, which is fully specified here.
+ */
+class Rng
+{
+  public:
+    explicit Rng(uint64_t seed) : state_(seed) {}
+
+    uint64_t next()
+    {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Uniform in [lo, hi].
+    long long uniform(long long lo, long long hi)
+    {
+        auto span = static_cast<unsigned __int128>(hi - lo) + 1;
+        return lo + static_cast<long long>((static_cast<unsigned __int128>(next()) * span) >> 64);
+    }
+
+    bool chance(double p) { return static_cast<double>(next() >> 11) * 0x1.0p-53 < p; }
+
+  private:
+    uint64_t state_;
+};
+
+// Buffered writer; inputs can be many gigabytes, so avoid iostreams formatting.
+class Writer
+{
+  public:
+    explicit Writer(std::FILE* out) : out_(out) { buffer_.reserve(kFlushSize + 256); }
+
+    // Call flush() explicitly to see write errors; this is a best effort.
+    ~Writer() { std::fwrite(buffer_.data(), 1, buffer_.size(), out_); }
+
+    Writer(const Writer&) = delete;
+    Writer& operator=(const Writer&) = delete;
+
+    Writer& operator<<(char c)
+    {
+        buffer_.push_back(c);
+        return maybe_flush();
+    }
+
+    Writer& operator<<(std::string_view s)
+    {
+        buffer_.append(s);
+        return maybe_flush();
+    }
+
+    Writer& operator<<(long long value)
+    {
+        char buf[24];
+        auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+        buffer_.append(buf, ptr);
+        return maybe_flush();
+    }
+
+    void flush()
+    {
+        if (!buffer_.empty() && std::fwrite(buffer_.data(), 1, buffer_.size(), out_) != buffer_.size())
+        {
+            throw std::runtime_error("Could not write output");
+        }
+        buffer_.clear();
+    }
+
+  private:
+    static constexpr size_t kFlushSize = 1 << 20;
+
+    std::FILE* out_;
+    std::string buffer_;
+
+    Writer& maybe_flush()
+    {
+        if (buffer_.size() >= kFlushSize)
+        {
+            flush();
+        }
+        return *this;
+    }
+};
+
+struct Params
+{
+    size_t size;   // Main scale knob; meaning depends on the day
+    size_t width;  // Line length / grid width where the format has one
+};
+
+// size = number of dial instructions
+void gen_day01(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        out << (rng.chance(0.5) ? 'L' : 'R') << rng.uniform(1, 999) << '\n';
+    }
+}
+
+// size = number of ranges; width = maximum range width
+void gen_day02(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        long long start = rng.uniform(1, 9'999'999'999LL);
+        long long end = start + rng.uniform(0, static_cast<long long>(p.width));
+        out << (i == 0 ? "" : ",") << start << '-' << end;
+    }
+    out << '\n';
+}
+
+// size = number of lines; width = digits per line
+void gen_day03(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        for (size_t j = 0; j < p.width; ++j)
+        {
+            out << static_cast<char>('1' + rng.uniform(0, 8));
+        }
+        out << '\n';
+    }
+}
+
+// size = rows; width = columns
+void gen_day04(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        for (size_t j = 0; j < p.width; ++j)
+        {
+            out << (rng.chance(0.65) ? '@' : '.');
+        }
+        out << '\n';
+    }
+}
+
+// size = number of ranges and of ids; width = maximum range width.
+// The default width is the id space over the range count: ranges then cover
+// about half the ids, and the merged range count grows in step with size.
+void gen_day05(Writer& out, Rng& rng, const Params& p)
+{
+    constexpr long long kMaxId = 562'949'953'421'312LL;  // 2^49, same magnitude as real inputs
+    const long long max_width =
+        p.width != 0 ? static_cast<long long>(p.width) : kMaxId / static_cast<long long>(std::max<size_t>(p.size, 1));
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        long long start = rng.uniform(1, kMaxId);
+        out << start << '-' << start + rng.uniform(0, max_width) << '\n';
+    }
+    out << '\n';
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        out << rng.uniform(1, kMaxId) << '\n';
+    }
+}
+
+// size = number of problems (columns of the worksheet), four operand rows
+void gen_day06(Writer& out, Rng& rng, const Params& p)
+{
+    constexpr int kRows = 4;
+    std::vector<std::array<long long, kRows>> numbers(p.size);
+    std::vector<int> widths(p.size);
+    std::vector<bool> right_aligned(p.size);
+    for (size_t c = 0; c < p.size; ++c)
+    {
+        int width = 0;
+        for (auto& n : numbers[c])
+        {
+            n = rng.uniform(1, 9999);
+            width = std::max(width, static_cast<int>(std::to_string(n).size()));
+        }
+        widths[c] = width;
+        right_aligned[c] = rng.chance(0.5);
+    }
+
+    for (int r = 0; r < kRows; ++r)
+    {
+        for (size_t c = 0; c < p.size; ++c)
+        {
+            auto digits = std::to_string(numbers[c][r]);
+            std::string pad(widths[c] - digits.size(), ' ');
+            out << (c == 0 ? "" : " ") << (right_aligned[c] ? pad : "") << digits << (right_aligned[c] ? "" : pad);
+        }
+        out << '\n';
+    }
+    for (size_t c = 0; c < p.size; ++c)
+    {
+        out << (c == 0 ? "" : " ") << (rng.chance(0.5) ? '+' : '*') << std::string(widths[c] - 1, ' ');
+    }
+    out << '\n';
+}
+
+// size = rows; width = columns. Splitters on every other row below the start.
+// Each splitter row multiplies the expected part 2 timeline count by about
+// (1 + density), so past ~220 rows the density drops to keep that count near
+// 2^48, well inside 64 bits. Tall inputs therefore get sparser splitters.
+void gen_day07(Writer& out, Rng& rng, const Params& p)
+{
+    const double splitter_rows = static_cast<double>(std::max<size_t>(p.size / 2, 1));
+    const double density = std::min(0.35, std::exp2(48.0 / splitter_rows) - 1.0);
+
+    std::string row(std::max<size_t>(p.width, 1), '.');
+    row[row.size() / 2] = 'S';
+    out << row << '\n';
+    for (size_t i = 1; i < p.size; ++i)
+    {
+        std::fill(row.begin(), row.end(), '.');
+        if (i % 2 == 0)
+        {
+            for (size_t j = 1; j + 1 < row.size(); ++j)
+            {
+                if (rng.chance(density))
+                {
+                    row[j] = '^';
+                }
+            }
+        }
+        out << row << '\n';
+    }
+}
+
+// size = number of junction boxes
+void gen_day08(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        out << rng.uniform(0, 99'999) << ',' << rng.uniform(0, 99'999) << ',' << rng.uniform(0, 99'999) << '\n';
+    }
+}
+
+// size = number of polygon vertices (rounded to an even count >= 4).
+// A rectilinear "skyline": distinct x positions with a random height between
+// consecutive ones, closed along y = 0.
+void gen_day09(Writer& out, Rng& rng, const Params& p)
+{
+    const size_t num_bars = (std::max<size_t>(p.size, 4) - 2) / 2;
+    const long long max_coord = std::max<long long>(100'000, 20 * static_cast<long long>(num_bars));
+
+    // Strictly increasing x positions with random gaps
+    std::vector<long long> xs(num_bars + 1);
+    const long long max_gap = std::max<long long>(2, 2 * max_coord / static_cast<long long>(num_bars + 1));
+    xs[0] = rng.uniform(0, max_gap);
+    for (size_t i = 1; i <= num_bars; ++i)
+    {
+        xs[i] = xs[i - 1] + rng.uniform(1, max_gap);
+    }
+
+    out << xs[0] << ",0\n";
+    long long prev_height = 0;
+    for (size_t i = 0; i < num_bars; ++i)
+    {
+        long long height = rng.uniform(1, max_coord);
+        if (height == prev_height)
+        {
+            ++height;
+        }
+        out << xs[i] << ',' << height << '\n' << xs[i + 1] << ',' << height << '\n';
+        prev_height = height;
+    }
+    out << xs[num_bars] << ",0\n";
+}
+
+// size = number of machines. Targets come from random presses, so every
+// machine is solvable for both parts.
+void gen_day10(Writer& out, Rng& rng, const Params& p)
+{
+    for (size_t m = 0; m < p.size; ++m)
+    {
+        const int num_lights = static_cast<int>(rng.uniform(4, 10));
+        const int num_buttons = static_cast<int>(rng.uniform(3, num_lights + 2));
+
+        std::vector<std::vector<int>> buttons(num_buttons);
+        for (auto& button : buttons)
+        {
+            for (int i = 0; i < num_lights; ++i)
+            {
+                if (rng.chance(0.35))
+                {
+                    button.push_back(i);
+                }
+            }
+            if (button.empty())
+            {
+                button.push_back(static_cast<int>(rng.uniform(0, num_lights - 1)));
+            }
+        }
+
+        std::vector<int> lights(num_lights, 0);
+        std::vector<long long> joltage(num_lights, 0);
+        for (const auto& button : buttons)
+        {
+            bool toggle = rng.chance(0.5);
+            long long presses = rng.uniform(0, 30);
+            for (int i : button)
+            {
+                lights[i] ^= toggle;
+                joltage[i] += presses;
+            }
+        }
+
+        out << '[';
+        for (int light : lights)
+        {
+            out << (light ? '#' : '.');
+        }
+        out << ']';
+        for (const auto& button : buttons)
+        {
+            out << " (";
+            for (size_t i = 0; i < button.size(); ++i)
+            {
+                out << (i == 0 ? "" : ",") << static_cast<long long>(button[i]);
+            }
+            out << ')';
+        }
+        out << " {";
+        for (int i = 0; i < num_lights; ++i)
+        {
+            out << (i == 0 ? "" : ",") << joltage[i];
+        }
+        out << "}\n";
+    }
+}
+
+// size = number of nodes; width = nodes per layer.
+// A layered DAG: every node links into the next layer, so everything reaches
+// "out". Layer spines chain svr -> you -> ... -> fft -> ... -> dac -> ... -> out.
+// Extra edges are rare enough that path counts stay well inside 64 bits.
+// depth = size / width, and the path-counting DFS recurses once per layer, so
+// for very large sizes raise width too (--width 64 handles 10^6 nodes).
+void gen_day11(Writer& out, Rng& rng, const Params& p)
+{
+    const size_t width = std::max<size_t>(1, p.width);
+    const size_t depth = std::max<size_t>(6, p.size / width);
+    const double branch_chance = std::min(0.5, 24.0 / static_cast<double>(depth));
+
+    // Unique lowercase names, long enough for the node count, avoiding the special ones
+    // (the last letter is fixed, so name_len letters give 26^(name_len - 1) names)
+    size_t name_len = 3;
+    for (size_t capacity = 26 * 26; capacity < depth * width + 16; capacity *= 26)
+    {
+        ++name_len;
+    }
+    const auto name_of = [&](size_t layer, size_t slot) -> std::string {
+        if (slot == 0)
+        {
+            if (layer == 0)
+                return "svr";
+            if (layer == 1)
+                return "you";
+            if (layer == depth / 3)
+                return "fft";
+            if (layer == 2 * depth / 3)
+                return "dac";
+        }
+        if (layer == depth)
+        {
+            return "out";
+        }
+        // Bijective, so distinct ids give distinct names; a trailing 'z'
+        // keeps generated names from colliding with the special ones.
+        size_t id = layer * width + slot;
+        std::string name(name_len, 'a');
+        for (size_t i = 0; i + 1 < name_len; ++i)
+        {
+            name[i] = static_cast<char>('a' + id % 26);
+            id /= 26;
+        }
+        assert(id == 0 && "Node ids must fit the name length");
+        name.back() = 'z';
+        return name;
+    };
+
+    for (size_t layer = 0; layer < depth; ++layer)
+    {
+        const bool next_is_out = layer + 1 == depth;
+        for (size_t slot = 0; slot < width; ++slot)
+        {
+            out << name_of(layer, slot) << ':';
+            if (next_is_out)
+            {
+                out << " out\n";
+                continue;
+            }
+            size_t first = slot == 0 ? 0 : static_cast<size_t>(rng.uniform(0, static_cast<long long>(width) - 1));
+            out << ' ' << name_of(layer + 1, first);
+            if (rng.chance(branch_chance))
+            {
+                size_t second = static_cast<size_t>(rng.uniform(0, static_cast<long long>(width) - 1));
+                if (second != first)
+                {
+                    out << ' ' << name_of(layer + 1, second);
+                }
+            }
+            out << '\n';
+        }
+    }
+}
+
+// size = number of regions; six 3x3 present shapes
+void gen_day12(Writer& out, Rng& rng, const Params& p)
+{
+    constexpr int kShapes = 6;
+    for (int s = 0; s < kShapes; ++s)
+    {
+        out << static_cast<long long>(s) << ":\n";
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                out << ((r == 1 && c == 1) || rng.chance(0.7) ? '#' : '.');
+            }
+            out << '\n';
+        }
+        out << '\n';
+    }
+    for (size_t i = 0; i < p.size; ++i)
+    {
+        long long w = rng.uniform(4, 50);
+        long long h = rng.uniform(4, 50);
+        out << w << 'x' << h << ':';
+        long long budget = w * h / 7;
+        for (int s = 0; s < kShapes; ++s)
+        {
+            out << ' ' << rng.uniform(0, std::max<long long>(1, budget / 3));
+        }
+        out << '\n';
+    }
+}
+
+struct Generator
+{
+    void (*fn)(Writer&, Rng&, const Params&);
+    Params defaults;  // Roughly the size of the real puzzle input
+};
+
+constexpr std::array<Generator, 12> kGenerators = {{
+    {gen_day01, {4'500, 0}},
+    {gen_day02, {40, 100'000}},
+    {gen_day03, {200, 100}},
+    {gen_day04, {140, 140}},
+    {gen_day05, {190, 0}},
+    {gen_day06, {1'000, 0}},
+    {gen_day07, {142, 141}},
+    {gen_day08, {1'000, 0}},
+    {gen_day09, {500, 0}},
+    {gen_day10, {180, 0}},
+    {gen_day11, {600, 8}},
+    {gen_day12, {1'000, 0}},
+}};
+
+void print_usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0 << " --day N [options]\n"
+              << "  --size N       Scale knob: instructions, ranges, rows, boxes, vertices... (per day)\n"
+              << "  --width N      Line length / grid width / range width where the day has one\n"
+              << "                 (day 5: 0, the default, scales range width to the id space)\n"
+              << "  --seed N       PRNG seed (default 1); same seed and knobs give the same bytes\n"
+              << "  --output PATH  Write to PATH instead of stdout\n";
+}
+
+}  // namespace aoc::gen
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        using namespace aoc;
+        using namespace aoc::gen;
+
+        int day = 0;
+        uint64_t seed = 1;
+        std::optional<size_t> size;
+        std::optional<size_t> width;
+        std::string output;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view arg = argv[i];
+            if (i + 1 >= argc)
+            {
+                throw std::runtime_error("Missing value for " + std::string(arg));
+            }
+            std::string_view value = argv[++i];
+
+            if (arg == "--day")
+            {
+                day = to_int<int>(value);
+            }
+            else if (arg == "--size")
+            {
+                size = to_int<size_t>(value);
+            }
+            else if (arg == "--width")
+            {
+                width = to_int<size_t>(value);
+            }
+            else if (arg == "--seed")
+            {
+                seed = to_int<uint64_t>(value);
+            }
+            else if (arg == "--output")
+            {
+                output = value;
+            }
+            else
+            {
+                throw std::runtime_error("Unknown argument: " + std::string(arg));
+            }
+        }
+
+        if (day < 1 || day > static_cast<int>(kGenerators.size()))
+        {
+            throw std::runtime_error("--day must be between 1 and 12");
+        }
+
+        const auto& generator = kGenerators[day - 1];
+        Params params = generator.defaults;
+        params.size = size.value_or(params.size);
+        params.width = width.value_or(params.width);
+
+        std::FILE* file = output.empty() ? stdout : std::fopen(output.c_str(), "wb");
+        if (file == nullptr)
+        {
+            throw std::runtime_error("Could not open output: " + output);
+        }
+
+        Rng rng(seed);
+        {
+            Writer writer(file);
+            generator.fn(writer, rng, params);
+            writer.flush();
+        }
+
+        if (file != stdout)
+        {
+            std::fclose(file);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        aoc::gen::print_usage(argv[0]);
+        return 1;
+    }
+
+    return 0;
+}